@@ -0,0 +1,982 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+// Microbenchmark for the DSP kernels in Source/MetasoundBranches/Private/DSP, built outside the engine through
+// the standalone mode of DSPCore.h. Every kernel is timed at each block size from 64 to 2048 frames and reported
+// in nanoseconds per frame (a stereo or quad figure covers all of its channels). Kernels with SIMD variants are
+// run at every level up to the host's; a level a kernel has no loop for runs the fallback it would get in the
+// plugin.
+//
+// With --check, nothing is timed: instead the kernels are checked against their documented accuracy, and each SIMD
+// level of the allpass chain against the scalar chain. The run fails if any check does.
+//
+// Usage: MetasoundBranchesDSPBenchmark [--quick | --check] [name filter]
+
+#include "MetasoundBranches/Private/DSP/DSPCore.h"
+#include "MetasoundBranches/Private/DSP/AllPassChain.h"
+#include "MetasoundBranches/Private/DSP/AllPassSections.h"
+#include "MetasoundBranches/Private/DSP/CounterRandom.h"
+#include "MetasoundBranches/Private/DSP/EdgeDetector.h"
+#include "MetasoundBranches/Private/DSP/FastMath.h"
+#include "MetasoundBranches/Private/DSP/InterleavedAllPassChain.h"
+#include "MetasoundBranches/Private/DSP/OnePoleSmoother.h"
+#include "MetasoundBranches/Private/DSP/PoissonScheduler.h"
+#include "MetasoundBranches/Private/DSP/Silence.h"
+#include "MetasoundBranches/Private/DSP/SimdDispatch.h"
+#include "MetasoundBranches/Private/DSP/StereoMatrix.h"
+#include "MetasoundBranches/Private/DSP/StereoModulation.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <string>
+
+namespace
+{
+    using namespace MetasoundBranches;
+
+    using FBuffer = TArray<float, TAlignedHeapAllocator<16>>;
+
+    constexpr float SampleRate = 48000.0f;
+    constexpr int32 BlockSizes[] = { 64, 128, 256, 512, 1024, 2048 };
+    constexpr int32 MaxBlockSize = 2048;
+
+    struct FOptions
+    {
+        // Frames run per timing; each block size is timed Repeats times and the fastest run is reported
+        int32 FramesPerRun = 1 << 18;
+        int32 Repeats = 5;
+
+        // Only kernels whose name contains this are run
+        std::string Filter;
+
+        // Run the accuracy checks instead of the timings
+        bool bCheck = false;
+    };
+
+    // Input signals shared by every kernel, long enough for the largest block (plus the frame of slack the
+    // stereo interleaved chain reads)
+    struct FSignals
+    {
+        FBuffer NoiseLeft;
+        FBuffer NoiseRight;
+        FBuffer NoiseLeftB;
+        FBuffer NoiseRightB;
+        FBuffer Sine;
+        FBuffer Zeros;
+
+        // Slow sweeps across each control's range, as a modulating LFO would give
+        FBuffer GainControl;
+        FBuffer BalanceControl;
+        FBuffer PositionControl;
+
+        // Smoothing times that change every frame, so the audio-rate coefficients take their per-frame path
+        FBuffer RiseTimes;
+        FBuffer FallTimes;
+
+        FSignals()
+        {
+            const int32 Num = (MaxBlockSize + 1) * 4;
+            FCounterRandom Random(1);
+
+            for (FBuffer* Buffer : { &NoiseLeft, &NoiseRight, &NoiseLeftB, &NoiseRightB })
+            {
+                Buffer->SetNumZeroed(Num);
+                Random.GenerateFractions(Buffer->GetData(), Num);
+                for (int32 i = 0; i < Num; ++i)
+                {
+                    (*Buffer)[i] = (*Buffer)[i] * 2.0f - 1.0f;
+                }
+            }
+
+            for (FBuffer* Buffer : { &Sine, &Zeros, &GainControl, &BalanceControl, &PositionControl, &RiseTimes, &FallTimes })
+            {
+                Buffer->SetNumZeroed(Num);
+            }
+
+            for (int32 i = 0; i < Num; ++i)
+            {
+                const float Lfo = FMath::Sin(2.0f * UE_PI * static_cast<float>(i) / static_cast<float>(Num));
+
+                Sine[i] = FMath::Sin(2.0f * UE_PI * 1000.0f * static_cast<float>(i) / SampleRate);
+                GainControl[i] = 1.0f + Lfo;
+                BalanceControl[i] = Lfo;
+                PositionControl[i] = 0.5f + 0.5f * Lfo;
+                RiseTimes[i] = 0.01f + 0.005f * Lfo;
+                FallTimes[i] = 0.05f + 0.025f * Lfo;
+            }
+        }
+    };
+
+    // Keeps the optimiser from discarding kernel output
+    volatile float Sink = 0.0f;
+
+    bool Matches(const FOptions& Options, const std::string& Name)
+    {
+        return Options.Filter.empty() || Name.find(Options.Filter) != std::string::npos;
+    }
+
+    // Times one kernel at every block size and prints a row. MakeKernel(BlockSize) returns a callable that
+    // processes one block; it is built once per block size, so setup is not timed.
+    template<typename MakeKernelType>
+    void Measure(const FOptions& Options, const std::string& Name, MakeKernelType&& MakeKernel)
+    {
+        if (!Matches(Options, Name))
+        {
+            return;
+        }
+
+        std::printf("%-44s", Name.c_str());
+
+        for (const int32 BlockSize : BlockSizes)
+        {
+            auto Kernel = MakeKernel(BlockSize);
+            const int32 NumBlocks = FMath::Max(Options.FramesPerRun / BlockSize, 1);
+
+            // Warm the caches, branch predictors and any settling state
+            for (int32 Block = 0; Block < 4; ++Block)
+            {
+                Kernel();
+            }
+
+            double BestSeconds = 1.0e30;
+
+            for (int32 Repeat = 0; Repeat < Options.Repeats; ++Repeat)
+            {
+                const auto Start = std::chrono::steady_clock::now();
+
+                for (int32 Block = 0; Block < NumBlocks; ++Block)
+                {
+                    Kernel();
+                }
+
+                const std::chrono::duration<double> Elapsed = std::chrono::steady_clock::now() - Start;
+                BestSeconds = std::min(BestSeconds, Elapsed.count());
+            }
+
+            const double NanosecondsPerFrame = BestSeconds * 1.0e9 / (static_cast<double>(NumBlocks) * BlockSize);
+            std::printf(" %8.3f", NanosecondsPerFrame);
+        }
+
+        std::printf("\n");
+        std::fflush(stdout);
+    }
+
+    std::string WithLevel(const char* Name, ESimdLevel Level)
+    {
+        return std::string(Name) + " [" + GetSimdLevelName(Level) + "]";
+    }
+
+    void RunAllPass(const FOptions& Options, const FSignals& Signals, ESimdLevel Level)
+    {
+        for (const int32 NumStages : { 8, 64 })
+        {
+            const std::string Name = "AllPassChain " + std::to_string(NumStages) + " stages";
+
+            Measure(Options, WithLevel(Name.c_str(), Level), [&Signals, Level, NumStages](int32 BlockSize)
+            {
+                auto Chain = std::make_shared<FAllPassChain>();
+                auto Buffer = std::make_shared<FBuffer>(Signals.NoiseLeft);
+                Chain->Init(NumStages, 0.5f, Level);
+
+                return [Chain, Buffer, BlockSize, NumStages]()
+                {
+                    Chain->ProcessInPlace(Buffer->GetData(), BlockSize, NumStages);
+                    Sink = (*Buffer)[0];
+                };
+            });
+        }
+    }
+
+    // Frames of noise fed before each decay, and frames of silence timed after it
+    constexpr int32 BurstFrames = 2048;
+    constexpr int32 DecayFrames = 4096;
+
+    // Times a kernel ringing out after a noise burst: BurstFrames of noise, untimed, then DecayFrames of silence,
+    // timed, repeated for each block size, and printed as a row like Measure's. MakeKernel(BlockSize) returns a
+    // callable that processes one block of the buffer it is given in place. This is where feedback state sinks
+    // through the subnormal range, so the row shows what FScopedDenormalGuard and FlushDenormals leave of it.
+    template<typename MakeKernelType>
+    void MeasureDecay(const FOptions& Options, const FSignals& Signals, const std::string& Name, MakeKernelType&& MakeKernel)
+    {
+        if (!Matches(Options, Name))
+        {
+            return;
+        }
+
+        std::printf("%-44s", Name.c_str());
+
+        for (const int32 BlockSize : BlockSizes)
+        {
+            auto Kernel = MakeKernel(BlockSize);
+            FBuffer Buffer = Signals.Zeros;
+            const int32 NumDecays = FMath::Max(Options.FramesPerRun / DecayFrames, 1);
+
+            double BestSeconds = 1.0e30;
+
+            for (int32 Repeat = 0; Repeat < Options.Repeats; ++Repeat)
+            {
+                double Seconds = 0.0;
+
+                for (int32 Decay = 0; Decay < NumDecays; ++Decay)
+                {
+                    for (int32 Frame = 0; Frame < BurstFrames; Frame += BlockSize)
+                    {
+                        FMemory::Memcpy(Buffer.GetData(), Signals.NoiseLeft.GetData(), BlockSize * sizeof(float));
+                        Kernel(Buffer.GetData());
+                    }
+
+                    const auto Start = std::chrono::steady_clock::now();
+
+                    for (int32 Frame = 0; Frame < DecayFrames; Frame += BlockSize)
+                    {
+                        FMemory::Memzero(Buffer.GetData(), BlockSize * sizeof(float));
+                        Kernel(Buffer.GetData());
+                    }
+
+                    const std::chrono::duration<double> Elapsed = std::chrono::steady_clock::now() - Start;
+                    Seconds += Elapsed.count();
+                }
+
+                Sink = Buffer[0];
+                BestSeconds = std::min(BestSeconds, Seconds);
+            }
+
+            std::printf(" %8.3f", BestSeconds * 1.0e9 / (static_cast<double>(NumDecays) * DecayFrames));
+        }
+
+        std::printf("\n");
+        std::fflush(stdout);
+    }
+
+    // The FAllPassChain recursion as a plain loop, without the denormal guard or flush: what the decay would
+    // cost without them
+    class FUnguardedAllPassChain
+    {
+    public:
+        explicit FUnguardedAllPassChain(int32 InNumStages)
+            : NumStages(InNumStages)
+        {
+            Delay0.SetNumZeroed(NumStages);
+            Delay1.SetNumZeroed(NumStages);
+        }
+
+        void ProcessInPlace(float* InOutBuffer, int32 NumFrames, float Coefficient)
+        {
+            for (int32 Stage = 0; Stage < NumStages; ++Stage)
+            {
+                for (int32 i = 0; i < NumFrames; ++i)
+                {
+                    const float OutSample = Delay0[Stage] - Coefficient * InOutBuffer[i];
+                    Delay0[Stage] = Delay1[Stage];
+                    Delay1[Stage] = InOutBuffer[i] + Coefficient * OutSample;
+                    InOutBuffer[i] = OutSample;
+                }
+            }
+        }
+
+    private:
+        FBuffer Delay0;
+        FBuffer Delay1;
+        int32 NumStages;
+    };
+
+    void RunAllPassDecay(const FOptions& Options, const FSignals& Signals, ESimdLevel Level)
+    {
+        MeasureDecay(Options, Signals, WithLevel("AllPassChain 64 stages, decay", Level), [Level](int32 BlockSize)
+        {
+            auto Chain = std::make_shared<FAllPassChain>();
+            Chain->Init(64, 0.5f, Level);
+
+            return [Chain, BlockSize](float* Buffer)
+            {
+                Chain->ProcessInPlace(Buffer, BlockSize, 64);
+            };
+        });
+    }
+
+    void RunUnguardedAllPassDecay(const FOptions& Options, const FSignals& Signals)
+    {
+        MeasureDecay(Options, Signals, "AllPass 64 stages unguarded, decay", [](int32 BlockSize)
+        {
+            auto Chain = std::make_shared<FUnguardedAllPassChain>(64);
+
+            return [Chain, BlockSize](float* Buffer)
+            {
+                Chain->ProcessInPlace(Buffer, BlockSize, 0.5f);
+            };
+        });
+
+        MeasureDecay(Options, Signals, "AllPass 64 stages unguarded, noise", [&Signals](int32 BlockSize)
+        {
+            auto Chain = std::make_shared<FUnguardedAllPassChain>(64);
+
+            return [Chain, &Signals, BlockSize](float* Buffer)
+            {
+                FMemory::Memcpy(Buffer, Signals.NoiseRight.GetData(), BlockSize * sizeof(float));
+                Chain->ProcessInPlace(Buffer, BlockSize, 0.5f);
+            };
+        });
+    }
+
+    // Sixteen resonant sections spread across the spectrum, stable for any block (|A1| < 1 + A2, A2 < 1)
+    FAllPassSectionTable MakeSectionTable(int32 NumSections)
+    {
+        FAllPassSectionTable Table;
+        Table.A1.SetNumZeroed(NumSections);
+        Table.A2.SetNumZeroed(NumSections);
+
+        for (int32 Section = 0; Section < NumSections; ++Section)
+        {
+            const float Radius = 0.8f;
+            const float Angle = UE_PI * (static_cast<float>(Section) + 0.5f) / static_cast<float>(NumSections);
+            Table.A1[Section] = -2.0f * Radius * FMath::Cos(Angle);
+            Table.A2[Section] = Radius * Radius;
+        }
+
+        return Table;
+    }
+
+    void RunAllPassSections(const FOptions& Options, const FSignals& Signals)
+    {
+        Measure(Options, "AllPassSections 16 sections", [&Signals](int32 BlockSize)
+        {
+            auto Chain = std::make_shared<FAllPassSectionChain>();
+            auto Table = std::make_shared<FAllPassSectionTable>(MakeSectionTable(16));
+            auto Buffer = std::make_shared<FBuffer>(Signals.NoiseLeft);
+            Chain->Init(16);
+
+            return [Chain, Table, Buffer, BlockSize]()
+            {
+                Chain->ProcessInPlace(Buffer->GetData(), BlockSize, *Table);
+                Sink = (*Buffer)[0];
+            };
+        });
+    }
+
+    void RunAllPassSectionsDecay(const FOptions& Options, const FSignals& Signals)
+    {
+        MeasureDecay(Options, Signals, "AllPassSections 16 sections, decay", [](int32 BlockSize)
+        {
+            auto Chain = std::make_shared<FAllPassSectionChain>();
+            auto Table = std::make_shared<FAllPassSectionTable>(MakeSectionTable(16));
+            Chain->Init(16);
+
+            return [Chain, Table, BlockSize](float* Buffer)
+            {
+                Chain->ProcessInPlace(Buffer, BlockSize, *Table);
+            };
+        });
+    }
+
+    template<int32 NumChannels>
+    void RunInterleavedAllPass(const FOptions& Options, const FSignals& Signals, const char* Name)
+    {
+        Measure(Options, Name, [&Signals](int32 BlockSize)
+        {
+            auto Chain = std::make_shared<TInterleavedAllPassChain<NumChannels>>();
+            auto Buffer = std::make_shared<FBuffer>(Signals.NoiseLeft);
+            Chain->Init(64);
+
+            return [Chain, Buffer, BlockSize]()
+            {
+                Chain->ProcessInPlace(Buffer->GetData(), BlockSize, 64);
+                Sink = (*Buffer)[0];
+            };
+        });
+    }
+
+    void RunSmoothers(const FOptions& Options, const FSignals& Signals)
+    {
+        using FBlockSmoother = TOnePoleSmoother<FSmootherBlockCoefficients>;
+        using FAudioRateSmoother = TOnePoleSmoother<FSmootherAudioRateCoefficients>;
+
+        Measure(Options, "Smoother block times, audio target", [&Signals](int32 BlockSize)
+        {
+            auto Smoother = std::make_shared<FBlockSmoother>(FSmootherBlockCoefficients(SampleRate));
+            auto Out = std::make_shared<FBuffer>(Signals.Zeros);
+            Smoother->GetCoefficients().Update(0.01f, 0.05f);
+
+            return [Smoother, Out, &Signals, BlockSize]()
+            {
+                Smoother->Process(FSmootherBufferInput{ Signals.NoiseLeft.GetData() }, Out->GetData(), BlockSize);
+                Sink = (*Out)[0];
+            };
+        });
+
+        Measure(Options, "Smoother block times, toggled target", [&Signals](int32 BlockSize)
+        {
+            auto Smoother = std::make_shared<FBlockSmoother>(FSmootherBlockCoefficients(SampleRate));
+            auto Out = std::make_shared<FBuffer>(Signals.Zeros);
+            auto bValue = std::make_shared<bool>(false);
+            Smoother->GetCoefficients().Update(0.01f, 0.01f);
+
+            return [Smoother, Out, bValue, BlockSize]()
+            {
+                *bValue = !*bValue;
+                Smoother->Process(FSmootherConstantInput(*bValue), Out->GetData(), BlockSize);
+                Sink = (*Out)[0];
+            };
+        });
+
+        Measure(Options, "Smoother block times, settled", [&Signals](int32 BlockSize)
+        {
+            auto Smoother = std::make_shared<FBlockSmoother>(FSmootherBlockCoefficients(SampleRate));
+            auto Out = std::make_shared<FBuffer>(Signals.Zeros);
+            Smoother->GetCoefficients().Update(0.01f, 0.01f);
+            Smoother->Reset(1.0f);
+
+            return [Smoother, Out, BlockSize]()
+            {
+                Smoother->Process(FSmootherConstantInput(1.0f), Out->GetData(), BlockSize);
+                Sink = (*Out)[0];
+            };
+        });
+
+        Measure(Options, "Smoother audio-rate times, audio target", [&Signals](int32 BlockSize)
+        {
+            auto Smoother = std::make_shared<FAudioRateSmoother>(FSmootherAudioRateCoefficients(SampleRate, MaxBlockSize));
+            auto Out = std::make_shared<FBuffer>(Signals.Zeros);
+
+            return [Smoother, Out, &Signals, BlockSize]()
+            {
+                Smoother->GetCoefficients().Update(Signals.RiseTimes.GetData(), Signals.FallTimes.GetData(), BlockSize);
+                Smoother->Process(FSmootherBufferInput{ Signals.NoiseLeft.GetData() }, Out->GetData(), BlockSize);
+                Sink = (*Out)[0];
+            };
+        });
+    }
+
+    // As the Dust node: zero the block, then write an impulse at each scheduled frame
+    void RunPoisson(const FOptions& Options, const FSignals& Signals)
+    {
+        auto MakeDust = [&Signals](const float* Modulation, float RateHz)
+        {
+            return [&Signals, Modulation, RateHz](int32 BlockSize)
+            {
+                auto Scheduler = std::make_shared<FPoissonScheduler>();
+                auto Out = std::make_shared<FBuffer>(Signals.Zeros);
+                Scheduler->Init(SampleRate, 1);
+
+                return [Scheduler, Out, Modulation, RateHz, BlockSize]()
+                {
+                    float* OutData = Out->GetData();
+                    FMemory::Memzero(OutData, BlockSize * sizeof(float));
+                    Scheduler->Process(Modulation, RateHz, BlockSize, [OutData](int32 Frame)
+                    {
+                        OutData[Frame] = 1.0f;
+                    });
+                    Sink = OutData[0];
+                };
+            };
+        };
+
+        Measure(Options, "PoissonScheduler 1 kHz", MakeDust(nullptr, 1000.0f));
+        Measure(Options, "PoissonScheduler 1 kHz, audio-rate offset", MakeDust(Signals.GainControl.GetData(), 1000.0f));
+    }
+
+    void RunCounterRandom(const FOptions& Options, const FSignals& Signals)
+    {
+        Measure(Options, "CounterRandom fractions", [&Signals](int32 BlockSize)
+        {
+            auto Random = std::make_shared<FCounterRandom>(1);
+            auto Out = std::make_shared<FBuffer>(Signals.Zeros);
+
+            return [Random, Out, BlockSize]()
+            {
+                Random->GenerateFractions(Out->GetData(), BlockSize);
+                Sink = (*Out)[0];
+            };
+        });
+    }
+
+    void RunEdgeDetector(const FOptions& Options, const FSignals& Signals)
+    {
+        Measure(Options, "EdgeDetector 1 kHz sine", [&Signals](int32 BlockSize)
+        {
+            auto Detector = std::make_shared<FEdgeDetector>();
+            Detector->Init(SampleRate);
+            Detector->SetDebounceTime(0.0f);
+
+            return [Detector, &Signals, BlockSize]()
+            {
+                int32 NumEdges = 0;
+                Detector->Process(Signals.Sine.GetData(), BlockSize, [&NumEdges](int32) { ++NumEdges; }, [&NumEdges](int32) { ++NumEdges; });
+                Sink = static_cast<float>(NumEdges);
+            };
+        });
+    }
+
+    void RunZeroCrossing(const FOptions& Options, const FSignals& Signals, ESimdLevel Level)
+    {
+        auto MakeDetector = [Level](const float* Signal)
+        {
+            return [Level, Signal](int32 BlockSize)
+            {
+                auto Detector = std::make_shared<FZeroCrossingDetector>();
+                Detector->Init(SampleRate, Level);
+                Detector->SetDebounceTime(0.0f);
+
+                return [Detector, Signal, BlockSize]()
+                {
+                    int32 NumCrossings = 0;
+                    Detector->Process(Signal, BlockSize, [&NumCrossings](int32) { ++NumCrossings; });
+                    Sink = static_cast<float>(NumCrossings);
+                };
+            };
+        };
+
+        Measure(Options, WithLevel("ZeroCrossing 1 kHz sine", Level), MakeDetector(Signals.Sine.GetData()));
+        Measure(Options, WithLevel("ZeroCrossing noise", Level), MakeDetector(Signals.NoiseLeft.GetData()));
+    }
+
+    void RunSilence(const FOptions& Options, const FSignals& Signals)
+    {
+        Measure(Options, "IsSilent on silence", [&Signals](int32 BlockSize)
+        {
+            return [&Signals, BlockSize]()
+            {
+                Sink = IsSilent(Signals.Zeros.GetData(), BlockSize) ? 1.0f : 0.0f;
+            };
+        });
+
+        Measure(Options, "SilenceGate stereo, silent", [&Signals](int32 BlockSize)
+        {
+            auto Gate = std::make_shared<FSilenceGate>();
+            auto OutLeft = std::make_shared<FBuffer>(Signals.Zeros);
+            auto OutRight = std::make_shared<FBuffer>(Signals.Zeros);
+
+            return [Gate, OutLeft, OutRight, &Signals, BlockSize]()
+            {
+                const float* Zeros = Signals.Zeros.GetData();
+                Sink = Gate->SkipBlock({ Zeros, Zeros }, { OutLeft->GetData(), OutRight->GetData() }, BlockSize) ? 1.0f : 0.0f;
+            };
+        });
+    }
+
+    // The outputs of a stereo kernel
+    struct FStereoOut
+    {
+        FBuffer Left;
+        FBuffer Right;
+
+        explicit FStereoOut(const FSignals& Signals) : Left(Signals.Zeros), Right(Signals.Zeros) {}
+    };
+
+    void RunStereoMatrix(const FOptions& Options, const FSignals& Signals, ESimdLevel Level)
+    {
+        auto MakeMatrix = [&Signals, Level](const FStereoMatrix& Matrix)
+        {
+            return [&Signals, Level, Matrix](int32 BlockSize)
+            {
+                auto Out = std::make_shared<FStereoOut>(Signals);
+                const FStereoMatrix::FProcessFunction Process = FStereoMatrix::GetProcessFunction(Level);
+
+                return [Out, &Signals, Process, Matrix, BlockSize]()
+                {
+                    Process(Matrix, Signals.NoiseLeft.GetData(), Signals.NoiseRight.GetData(), Out->Left.GetData(), Out->Right.GetData(), BlockSize);
+                    Sink = Out->Left[0];
+                };
+            };
+        };
+
+        Measure(Options, WithLevel("StereoMatrix gain", Level), MakeMatrix(FStereoMatrix::Gain(0.5f)));
+        Measure(Options, WithLevel("StereoMatrix width", Level), MakeMatrix(FStereoMatrix::Width(1.5f)));
+
+        Measure(Options, WithLevel("StereoMatrix ramp", Level), [&Signals, Level](int32 BlockSize)
+        {
+            auto Out = std::make_shared<FStereoOut>(Signals);
+            auto bForward = std::make_shared<bool>(false);
+            const FStereoMatrix::FRampFunction Ramp = FStereoMatrix::GetRampFunction(Level);
+            const FStereoMatrix From = FStereoMatrix::Width(0.5f);
+            const FStereoMatrix To = FStereoMatrix::Width(1.5f);
+
+            return [Out, bForward, &Signals, Ramp, From, To, BlockSize]()
+            {
+                *bForward = !*bForward;
+                Ramp(*bForward ? From : To, *bForward ? To : From, Signals.NoiseLeft.GetData(), Signals.NoiseRight.GetData(),
+                    Out->Left.GetData(), Out->Right.GetData(), BlockSize);
+                Sink = Out->Left[0];
+            };
+        });
+
+        Measure(Options, WithLevel("StereoCrossfade", Level), [&Signals, Level](int32 BlockSize)
+        {
+            auto Out = std::make_shared<FStereoOut>(Signals);
+            const FStereoCrossfade::FProcessFunction Process = FStereoCrossfade::GetProcessFunction(Level);
+            const FStereoCrossfade Crossfade = FStereoCrossfade::Position(0.3f);
+
+            return [Out, &Signals, Process, Crossfade, BlockSize]()
+            {
+                Process(Crossfade, Signals.NoiseLeft.GetData(), Signals.NoiseRight.GetData(), Signals.NoiseLeftB.GetData(),
+                    Signals.NoiseRightB.GetData(), Out->Left.GetData(), Out->Right.GetData(), BlockSize);
+                Sink = Out->Left[0];
+            };
+        });
+
+        Measure(Options, WithLevel("StereoCrossfade ramp", Level), [&Signals, Level](int32 BlockSize)
+        {
+            auto Out = std::make_shared<FStereoOut>(Signals);
+            auto bForward = std::make_shared<bool>(false);
+            const FStereoCrossfade::FRampFunction Ramp = FStereoCrossfade::GetRampFunction(Level);
+            const FStereoCrossfade From = FStereoCrossfade::Position(0.2f);
+            const FStereoCrossfade To = FStereoCrossfade::Position(0.8f);
+
+            return [Out, bForward, &Signals, Ramp, From, To, BlockSize]()
+            {
+                *bForward = !*bForward;
+                Ramp(*bForward ? From : To, *bForward ? To : From, Signals.NoiseLeft.GetData(), Signals.NoiseRight.GetData(),
+                    Signals.NoiseLeftB.GetData(), Signals.NoiseRightB.GetData(), Out->Left.GetData(), Out->Right.GetData(), BlockSize);
+                Sink = Out->Left[0];
+            };
+        });
+    }
+
+    template<typename SignalType>
+    void RunStereoMatrixSignal(const FOptions& Options, const FSignals& Signals, ESimdLevel Level, const char* Name, const FBuffer& Control)
+    {
+        Measure(Options, WithLevel(Name, Level), [&Signals, &Control, Level](int32 BlockSize)
+        {
+            auto Out = std::make_shared<FStereoOut>(Signals);
+            const typename SignalType::FProcessFunction Process = SignalType::GetProcessFunction(Level);
+
+            return [Out, &Signals, &Control, Process, BlockSize]()
+            {
+                SignalType Signal;
+                Signal.Control = Control.GetData();
+                Process(Signal, Signals.NoiseLeft.GetData(), Signals.NoiseRight.GetData(), Out->Left.GetData(), Out->Right.GetData(), BlockSize);
+                Sink = Out->Left[0];
+            };
+        });
+    }
+
+    void RunStereoModulation(const FOptions& Options, const FSignals& Signals, ESimdLevel Level)
+    {
+        RunStereoMatrixSignal<FStereoGainSignal>(Options, Signals, Level, "StereoGainSignal", Signals.GainControl);
+        RunStereoMatrixSignal<FStereoBalanceSignal>(Options, Signals, Level, "StereoBalanceSignal", Signals.BalanceControl);
+        RunStereoMatrixSignal<FStereoWidthSignal>(Options, Signals, Level, "StereoWidthSignal", Signals.GainControl);
+
+        Measure(Options, WithLevel("StereoCrossfadeSignal", Level), [&Signals, Level](int32 BlockSize)
+        {
+            auto Out = std::make_shared<FStereoOut>(Signals);
+            const FStereoCrossfadeSignal::FProcessFunction Process = FStereoCrossfadeSignal::GetProcessFunction(Level);
+
+            return [Out, &Signals, Process, BlockSize]()
+            {
+                FStereoCrossfadeSignal Signal;
+                Signal.Control = Signals.PositionControl.GetData();
+                Process(Signal, Signals.NoiseLeft.GetData(), Signals.NoiseRight.GetData(), Signals.NoiseLeftB.GetData(),
+                    Signals.NoiseRightB.GetData(), Out->Left.GetData(), Out->Right.GetData(), BlockSize);
+                Sink = Out->Left[0];
+            };
+        });
+    }
+
+    // The largest error a check found, and the input it was found at
+    struct FCheckResult
+    {
+        double MaxError = 0.0;
+        double At = 0.0;
+
+        void Add(double Error, double Input)
+        {
+            if (!(Error <= MaxError))
+            {
+                MaxError = Error;
+                At = Input;
+            }
+        }
+    };
+
+    // Prints a check's row and returns whether it passed. A NaN error fails.
+    bool Report(const std::string& Name, const FCheckResult& Result, double Bound)
+    {
+        const bool bPassed = Result.MaxError <= Bound;
+        std::printf("%-44s max error %9.3g at %-14.9g bound %9.3g  %s\n", Name.c_str(), Result.MaxError, Result.At, Bound,
+            bPassed ? "ok" : "FAILED");
+        std::fflush(stdout);
+        return bPassed;
+    }
+
+    // The bounds documented in FastMath.h
+    constexpr double Exp2RelativeBound = 1.0e-7;
+    constexpr double ExpRelativeBound = 1.5e-7;
+    constexpr double SinQuarterCycleAbsoluteBound = 8.2e-7;
+
+#if METASOUNDBRANCHES_DSP_X86_DISPATCH
+    METASOUNDBRANCHES_DSP_TARGET_AVX2 void SinQuarterCycleAVX2(const float* X, float* Out)
+    {
+        _mm256_storeu_ps(Out, FastMath::SinQuarterCycle(_mm256_loadu_ps(X)));
+    }
+#endif
+
+    // Checks FastMath against FMath in double precision; returns the number of checks that failed
+    int32 CheckFastMath(const FOptions& Options, ESimdLevel HostLevel)
+    {
+        constexpr double Ln2 = 0.69314718055994530942;
+        constexpr double HalfPi = 1.57079632679489661923;
+        int32 NumFailed = 0;
+
+        if (Matches(Options, "FastMath::Exp2"))
+        {
+            FCheckResult Result;
+            auto Check = [&Result](float X)
+            {
+                const double Expected = FMath::Exp(static_cast<double>(X) * Ln2);
+                Result.Add(FMath::Abs(static_cast<double>(FastMath::Exp2(X)) - Expected) / Expected, X);
+            };
+
+            // The documented range, which covers the clamp the smoother's zero times hit at -126
+            for (int32 i = 0; i <= (1 << 21); ++i)
+            {
+                Check(-126.0f + 252.0f * static_cast<float>(i) / static_cast<float>(1 << 21));
+            }
+
+            // The smoother's exponents, -log2(e) / (time * rate): a sweep of times from 10 us to 100 s at 44.1 to
+            // 96 kHz, down to exponents of -1.5e-7, where 1 - alpha must keep its precision
+            for (const float Rate : { 44100.0f, 48000.0f, 96000.0f })
+            {
+                for (int32 i = 0; i <= 4096; ++i)
+                {
+                    const float Seconds = std::pow(10.0f, -5.0f + 7.0f * static_cast<float>(i) / 4096.0f);
+                    Check((-UE_INV_LN2 / Rate) / Seconds);
+                }
+            }
+
+            NumFailed += Report("FastMath::Exp2 relative", Result, Exp2RelativeBound) ? 0 : 1;
+        }
+
+        if (Matches(Options, "FastMath::Exp"))
+        {
+            // Scaled by max(1, |X|), so the check is against a single bound
+            FCheckResult Result;
+
+            for (int32 i = 0; i <= (1 << 21); ++i)
+            {
+                const float X = -87.0f + 174.0f * static_cast<float>(i) / static_cast<float>(1 << 21);
+                const double Expected = FMath::Exp(static_cast<double>(X));
+                const double Error = FMath::Abs(static_cast<double>(FastMath::Exp(X)) - Expected) / Expected;
+                Result.Add(Error / FMath::Max(1.0, FMath::Abs(static_cast<double>(X))), X);
+            }
+
+            NumFailed += Report("FastMath::Exp relative / max(1, |X|)", Result, ExpRelativeBound) ? 0 : 1;
+        }
+
+        if (Matches(Options, "FastMath::SinQuarterCycle"))
+        {
+            constexpr int32 NumSteps = 1 << 20;
+
+            FBuffer Inputs;
+            Inputs.SetNumZeroed(NumSteps + 8);
+            for (int32 i = 0; i <= NumSteps; ++i)
+            {
+                Inputs[i] = static_cast<float>(i) / static_cast<float>(NumSteps);
+            }
+            for (int32 i = NumSteps + 1; i < Inputs.Num(); ++i)
+            {
+                Inputs[i] = 1.0f;
+            }
+
+            auto CheckOutputs = [&Inputs](const float* Outputs, int32 First, int32 Num, FCheckResult& Result)
+            {
+                for (int32 i = First; i < First + Num; ++i)
+                {
+                    const double Expected = FMath::Sin(HalfPi * static_cast<double>(Inputs[i]));
+                    Result.Add(FMath::Abs(static_cast<double>(Outputs[i - First]) - Expected), Inputs[i]);
+                }
+            };
+
+            FCheckResult Scalar;
+            FCheckResult Vector;
+
+            for (int32 i = 0; i <= NumSteps; ++i)
+            {
+                const float Output = FastMath::SinQuarterCycle(Inputs[i]);
+                CheckOutputs(&Output, i, 1, Scalar);
+            }
+
+            for (int32 i = 0; i <= NumSteps; i += 4)
+            {
+                alignas(16) float Outputs[4];
+                VectorStoreAligned(FastMath::SinQuarterCycle(VectorLoadAligned(Inputs.GetData() + i)), Outputs);
+                CheckOutputs(Outputs, i, 4, Vector);
+            }
+
+            // The ends are documented as exact
+            Scalar.Add((FastMath::SinQuarterCycle(0.0f) == 0.0f) ? 0.0 : 1.0, 0.0);
+            Scalar.Add((FastMath::SinQuarterCycle(1.0f) == 1.0f) ? 0.0 : 1.0, 1.0);
+
+            NumFailed += Report("FastMath::SinQuarterCycle absolute", Scalar, SinQuarterCycleAbsoluteBound) ? 0 : 1;
+            NumFailed += Report(WithLevel("FastMath::SinQuarterCycle absolute", ESimdLevel::Vector), Vector, SinQuarterCycleAbsoluteBound) ? 0 : 1;
+
+#if METASOUNDBRANCHES_DSP_X86_DISPATCH
+            if (HostLevel >= ESimdLevel::AVX2)
+            {
+                FCheckResult Wide;
+
+                for (int32 i = 0; i <= NumSteps; i += 8)
+                {
+                    float Outputs[8];
+                    SinQuarterCycleAVX2(Inputs.GetData() + i, Outputs);
+                    CheckOutputs(Outputs, i, 8, Wide);
+                }
+
+                NumFailed += Report(WithLevel("FastMath::SinQuarterCycle absolute", ESimdLevel::AVX2), Wide, SinQuarterCycleAbsoluteBound) ? 0 : 1;
+            }
+#else
+            (void)HostLevel;
+#endif
+        }
+
+        return NumFailed;
+    }
+
+    // Largest difference allowed between a SIMD level and the scalar chain. The levels differ only in rounding
+    // (the AVX2 groups use fused multiply-add), which stays well below this on full-scale noise.
+    constexpr double AllPassParityBound = 1.0e-5;
+
+    // Checks FAllPassChain at each level against ESimdLevel::Scalar; returns the number of levels that failed.
+    // The stage counts cover every mix of groups and leftover stages, and the block sizes include ones shorter
+    // than the widest group, so the ramp-in and ramp-out steps carry state across blocks. Each run ends in
+    // silence, so the ringing tail and the silent skip are compared too.
+    int32 CheckAllPassParity(const FOptions& Options, const FSignals& Signals, ESimdLevel HostLevel)
+    {
+        constexpr int32 StageCounts[] = { 1, 3, 4, 5, 7, 8, 9, 12, 13, 15, 16, 17, 23, 24, 25, 31, 33, 47, 64, 65 };
+        constexpr int32 CheckBlockSizes[] = { 1, 2, 3, 5, 7, 8, 11, 15, 16, 17, 31, 64, 100, 480 };
+        constexpr int32 NumBlocks = 48;
+        int32 NumFailed = 0;
+
+        for (int32 Level = static_cast<int32>(ESimdLevel::Vector); Level <= static_cast<int32>(HostLevel); ++Level)
+        {
+            const std::string Name = WithLevel("AllPassChain parity", static_cast<ESimdLevel>(Level));
+            if (!Matches(Options, Name))
+            {
+                continue;
+            }
+
+            FCheckResult Result;
+
+            for (const int32 NumStages : StageCounts)
+            {
+                for (const float Coefficient : { 0.5f, -0.7f })
+                {
+                    FAllPassChain Reference;
+                    FAllPassChain Chain;
+                    Reference.Init(NumStages, Coefficient, ESimdLevel::Scalar);
+                    Chain.Init(NumStages, Coefficient, static_cast<ESimdLevel>(Level));
+
+                    FBuffer Expected = Signals.Zeros;
+                    FBuffer Actual = Signals.Zeros;
+                    int32 Offset = 0;
+
+                    for (int32 Block = 0; Block < NumBlocks; ++Block)
+                    {
+                        const int32 BlockSize = CheckBlockSizes[(Block * 5 + NumStages) % static_cast<int32>(std::size(CheckBlockSizes))];
+                        const bool bIsSilent = Block >= NumBlocks / 2;
+
+                        for (int32 i = 0; i < BlockSize; ++i)
+                        {
+                            Expected[i] = bIsSilent ? 0.0f : Signals.NoiseLeft[(Offset + i) % Signals.NoiseLeft.Num()];
+                            Actual[i] = Expected[i];
+                        }
+                        Offset += BlockSize;
+
+                        Reference.ProcessInPlace(Expected.GetData(), BlockSize, NumStages);
+                        Chain.ProcessInPlace(Actual.GetData(), BlockSize, NumStages);
+
+                        for (int32 i = 0; i < BlockSize; ++i)
+                        {
+                            Result.Add(FMath::Abs(static_cast<double>(Actual[i]) - static_cast<double>(Expected[i])), NumStages);
+                        }
+                    }
+                }
+            }
+
+            NumFailed += Report(Name + ", by stages", Result, AllPassParityBound) ? 0 : 1;
+        }
+
+        return NumFailed;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    FOptions Options;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--quick") == 0)
+        {
+            Options.FramesPerRun = 1 << 14;
+            Options.Repeats = 1;
+        }
+        else if (std::strcmp(argv[i], "--check") == 0)
+        {
+            Options.bCheck = true;
+        }
+        else
+        {
+            Options.Filter = argv[i];
+        }
+    }
+
+    const ESimdLevel HostLevel = GetHostSimdLevel();
+
+    if (Options.bCheck)
+    {
+        std::printf("MetaSound Branches DSP kernels, accuracy checks (host SIMD level: %s)\n\n", GetSimdLevelName(HostLevel));
+
+        const FSignals Signals;
+        const int32 NumFailed = CheckFastMath(Options, HostLevel) + CheckAllPassParity(Options, Signals, HostLevel);
+        if (NumFailed > 0)
+        {
+            std::printf("\n%d check(s) failed\n", NumFailed);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    const FSignals Signals;
+
+    std::printf("MetaSound Branches DSP kernels, ns/frame at %.0f Hz (host SIMD level: %s)\n\n", SampleRate, GetSimdLevelName(HostLevel));
+    std::printf("%-44s", "Kernel / block size");
+    for (const int32 BlockSize : BlockSizes)
+    {
+        std::printf(" %8d", BlockSize);
+    }
+    std::printf("\n");
+
+    for (int32 Level = 0; Level <= static_cast<int32>(HostLevel); ++Level)
+    {
+        RunAllPass(Options, Signals, static_cast<ESimdLevel>(Level));
+    }
+    for (int32 Level = 0; Level <= static_cast<int32>(HostLevel); ++Level)
+    {
+        RunAllPassDecay(Options, Signals, static_cast<ESimdLevel>(Level));
+    }
+    RunUnguardedAllPassDecay(Options, Signals);
+    RunAllPassSections(Options, Signals);
+    RunAllPassSectionsDecay(Options, Signals);
+    RunInterleavedAllPass<2>(Options, Signals, "InterleavedAllPassChain x2 64 stages");
+    RunInterleavedAllPass<4>(Options, Signals, "InterleavedAllPassChain x4 64 stages");
+    RunSmoothers(Options, Signals);
+    RunPoisson(Options, Signals);
+    RunCounterRandom(Options, Signals);
+    RunEdgeDetector(Options, Signals);
+    for (int32 Level = 0; Level <= static_cast<int32>(HostLevel); ++Level)
+    {
+        RunZeroCrossing(Options, Signals, static_cast<ESimdLevel>(Level));
+    }
+    RunSilence(Options, Signals);
+    for (int32 Level = 0; Level <= static_cast<int32>(HostLevel); ++Level)
+    {
+        RunStereoMatrix(Options, Signals, static_cast<ESimdLevel>(Level));
+        RunStereoModulation(Options, Signals, static_cast<ESimdLevel>(Level));
+    }
+
+    return 0;
+}
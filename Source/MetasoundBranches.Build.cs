@@ -25,6 +25,7 @@ public class MetasoundBranches : ModuleRules
                 "CoreUObject",
                 "Engine",
                 "AudioExtensions",
+                "Projects",
                 "SignalProcessing"
             }
         );
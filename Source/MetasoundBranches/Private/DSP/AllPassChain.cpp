@@ -0,0 +1,286 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Private/DSP/AllPassChain.h"
+
+namespace MetasoundBranches
+{
+    namespace AllPassChainPrivate
+    {
+        // Build (Carry[CarryLane], Prev[0], Prev[1], Prev[2]): shift the previous step's lane outputs up by one lane
+        template<int32 CarryLane>
+        FORCEINLINE VectorRegister4Float ShiftIn(const VectorRegister4Float& Carry, const VectorRegister4Float& Prev)
+        {
+            const VectorRegister4Float Low = VectorShuffle(Carry, Prev, CarryLane, CarryLane, 0, 0);
+            return VectorShuffle(Low, Prev, 0, 2, 1, 2);
+        }
+
+        // FAllPassChain::TickStage on a state block offset to a group's first stage
+        FORCEINLINE float TickLane(float* Delay0, float* Delay1, int32 Lane, float InSample, float Coefficient)
+        {
+            const float OutSample = Delay0[Lane] - Coefficient * InSample;
+            Delay0[Lane] = Delay1[Lane];
+            Delay1[Lane] = InSample + Coefficient * OutSample;
+
+            return OutSample;
+        }
+
+        // Run the ramp-in or ramp-out steps of a pipelined group one lane at a time
+        template<int32 NumLanes>
+        FORCEINLINE void PartialStep(float* InOutBuffer, int32 NumFrames, int32 Step, float* Delay0, float* Delay1, float* LaneOutputs, float Coefficient)
+        {
+            for (int32 Lane = NumLanes - 1; Lane >= 0; --Lane)
+            {
+                const int32 Frame = Step - Lane;
+
+                if (Frame >= 0 && Frame < NumFrames)
+                {
+                    const float InSample = (Lane == 0) ? InOutBuffer[Frame] : LaneOutputs[Lane - 1];
+                    LaneOutputs[Lane] = TickLane(Delay0, Delay1, Lane, InSample, Coefficient);
+
+                    if (Lane == NumLanes - 1)
+                    {
+                        InOutBuffer[Frame] = LaneOutputs[Lane];
+                    }
+                }
+            }
+        }
+
+#if METASOUNDBRANCHES_DSP_X86_DISPATCH
+        // FAllPassChain::ProcessGroup with eight lanes per vector. Rotating each vector's lanes up by one puts
+        // lane 7 of the previous vector in lane 0, so the shift between vectors is a single blend.
+        template<int32 NumVectors>
+        METASOUNDBRANCHES_DSP_TARGET_AVX2 void ProcessGroupAVX2(float* InOutBuffer, int32 NumFrames, float* Delay0, float* Delay1, float Coefficient)
+        {
+            static constexpr int32 NumLanes = NumVectors * 8;
+            static constexpr int32 LastLane = NumLanes - 1;
+
+            alignas(32) float LaneOutputs[NumLanes] = {};
+
+            const int32 NumSteps = NumFrames + LastLane;
+            int32 Step = 0;
+
+            for (; Step < LastLane; ++Step)
+            {
+                PartialStep<NumLanes>(InOutBuffer, NumFrames, Step, Delay0, Delay1, LaneOutputs, Coefficient);
+            }
+
+            if (Step < NumFrames)
+            {
+                const __m256 Coef = _mm256_set1_ps(Coefficient);
+                const __m256i RotateUp = _mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6);
+                const __m256i LastLaneIndex = _mm256_set1_epi32(7);
+
+                __m256 D0[NumVectors];
+                __m256 D1[NumVectors];
+                __m256 Out[NumVectors];
+
+                for (int32 v = 0; v < NumVectors; ++v)
+                {
+                    D0[v] = _mm256_loadu_ps(Delay0 + v * 8);
+                    D1[v] = _mm256_loadu_ps(Delay1 + v * 8);
+                    Out[v] = _mm256_load_ps(LaneOutputs + v * 8);
+                }
+
+                for (; Step < NumFrames; ++Step)
+                {
+                    __m256 Rotated[NumVectors];
+                    __m256 In[NumVectors];
+
+                    for (int32 v = 0; v < NumVectors; ++v)
+                    {
+                        Rotated[v] = _mm256_permutevar8x32_ps(Out[v], RotateUp);
+                    }
+
+                    In[0] = _mm256_blend_ps(Rotated[0], _mm256_set1_ps(InOutBuffer[Step]), 0x01);
+                    for (int32 v = 1; v < NumVectors; ++v)
+                    {
+                        In[v] = _mm256_blend_ps(Rotated[v], Rotated[v - 1], 0x01);
+                    }
+
+                    for (int32 v = 0; v < NumVectors; ++v)
+                    {
+                        Out[v] = _mm256_fnmadd_ps(Coef, In[v], D0[v]);
+                        D0[v] = D1[v];
+                        D1[v] = _mm256_fmadd_ps(Coef, Out[v], In[v]);
+                    }
+
+                    InOutBuffer[Step - LastLane] = _mm_cvtss_f32(_mm256_castps256_ps128(_mm256_permutevar8x32_ps(Out[NumVectors - 1], LastLaneIndex)));
+                }
+
+                for (int32 v = 0; v < NumVectors; ++v)
+                {
+                    _mm256_storeu_ps(Delay0 + v * 8, D0[v]);
+                    _mm256_storeu_ps(Delay1 + v * 8, D1[v]);
+                    _mm256_store_ps(LaneOutputs + v * 8, Out[v]);
+                }
+            }
+
+            for (; Step < NumSteps; ++Step)
+            {
+                PartialStep<NumLanes>(InOutBuffer, NumFrames, Step, Delay0, Delay1, LaneOutputs, Coefficient);
+            }
+        }
+#endif
+    }
+
+    void FAllPassChain::Init(int32 InMaxStages, float InCoefficient, ESimdLevel InSimdLevel)
+    {
+        MaxStages = FMath::Max(InMaxStages, 0);
+        StateStride = Align(MaxStages, LanesPerVector);
+        Coefficient = InCoefficient;
+        SimdLevel = InSimdLevel;
+
+        State.SetNumZeroed(StateStride * 2);
+        bIsStateSilent = true;
+    }
+
+    void FAllPassChain::Reset()
+    {
+        FMemory::Memzero(State.GetData(), State.Num() * sizeof(float));
+        bIsStateSilent = true;
+    }
+
+    void FAllPassChain::ProcessInPlace(float* InOutBuffer, int32 NumFrames, int32 NumStages)
+    {
+        NumStages = FMath::Clamp(NumStages, 0, MaxStages);
+
+        if (NumFrames <= 0 || (bIsStateSilent && IsSilent(InOutBuffer, NumFrames)))
+        {
+            return;
+        }
+
+        FScopedDenormalGuard DenormalGuard;
+
+        int32 Stage = 0;
+
+        // Widest groups first; what is left over goes to the narrower ones. AVX-512 runs the AVX2 groups: wider
+        // groups spend longer ramping in and out one lane at a time, which cancels the gain.
+#if METASOUNDBRANCHES_DSP_X86_DISPATCH
+        {
+            using namespace AllPassChainPrivate;
+
+            float* Delay0 = State.GetData();
+            float* Delay1 = Delay0 + StateStride;
+
+            if (SimdLevel >= ESimdLevel::AVX2)
+            {
+                for (; Stage + 16 <= NumStages; Stage += 16)
+                {
+                    ProcessGroupAVX2<2>(InOutBuffer, NumFrames, Delay0 + Stage, Delay1 + Stage, Coefficient);
+                }
+
+                if (Stage + 8 <= NumStages)
+                {
+                    ProcessGroupAVX2<1>(InOutBuffer, NumFrames, Delay0 + Stage, Delay1 + Stage, Coefficient);
+                    Stage += 8;
+                }
+            }
+        }
+#endif
+
+        if (SimdLevel >= ESimdLevel::Vector)
+        {
+            for (; Stage + 2 * LanesPerVector <= NumStages; Stage += 2 * LanesPerVector)
+            {
+                ProcessGroup<2 * LanesPerVector>(InOutBuffer, NumFrames, Stage);
+            }
+
+            if (Stage + LanesPerVector <= NumStages)
+            {
+                ProcessGroup<LanesPerVector>(InOutBuffer, NumFrames, Stage);
+                Stage += LanesPerVector;
+            }
+        }
+
+        for (; Stage < NumStages; ++Stage)
+        {
+            ProcessStage(InOutBuffer, NumFrames, Stage);
+        }
+
+        FlushDenormals(State.GetData(), State.Num());
+        bIsStateSilent = IsSilent(State.GetData(), State.Num());
+    }
+
+    template<int32 NumLanes>
+    void FAllPassChain::ProcessGroup(float* InOutBuffer, int32 NumFrames, int32 FirstStage)
+    {
+        using namespace AllPassChainPrivate;
+
+        static constexpr int32 NumVectors = NumLanes / LanesPerVector;
+        static constexpr int32 LastLane = NumLanes - 1;
+
+        // Most recent output of each lane, i.e. the input of the next lane on the following step
+        alignas(16) float LaneOutputs[NumLanes] = {};
+
+        float* Delay0 = State.GetData() + FirstStage;
+        float* Delay1 = Delay0 + StateStride;
+
+        // At step t, lane j processes frame (t - j). Steps where some lanes fall outside the block
+        // (ramping the wavefront in and out) are run one lane at a time.
+        const int32 NumSteps = NumFrames + LastLane;
+        int32 Step = 0;
+
+        for (; Step < LastLane; ++Step)
+        {
+            PartialStep<NumLanes>(InOutBuffer, NumFrames, Step, Delay0, Delay1, LaneOutputs, Coefficient);
+        }
+
+        if (Step < NumFrames)
+        {
+            const VectorRegister4Float Coef = VectorSetFloat1(Coefficient);
+
+            VectorRegister4Float D0[NumVectors];
+            VectorRegister4Float D1[NumVectors];
+            VectorRegister4Float Out[NumVectors];
+
+            for (int32 v = 0; v < NumVectors; ++v)
+            {
+                D0[v] = VectorLoadAligned(Delay0 + v * LanesPerVector);
+                D1[v] = VectorLoadAligned(Delay1 + v * LanesPerVector);
+                Out[v] = VectorLoadAligned(LaneOutputs + v * LanesPerVector);
+            }
+
+            // Every lane is inside the block: one vector step advances all stages of the group
+            for (; Step < NumFrames; ++Step)
+            {
+                VectorRegister4Float In[NumVectors];
+
+                In[0] = ShiftIn<0>(VectorSetFloat1(InOutBuffer[Step]), Out[0]);
+                for (int32 v = 1; v < NumVectors; ++v)
+                {
+                    In[v] = ShiftIn<3>(Out[v - 1], Out[v]);
+                }
+
+                for (int32 v = 0; v < NumVectors; ++v)
+                {
+                    Out[v] = VectorNegateMultiplyAdd(Coef, In[v], D0[v]);
+                    D0[v] = D1[v];
+                    D1[v] = VectorMultiplyAdd(Coef, Out[v], In[v]);
+                }
+
+                // Written behind the read position, so the group can run in place
+                InOutBuffer[Step - LastLane] = VectorGetComponent(Out[NumVectors - 1], 3);
+            }
+
+            for (int32 v = 0; v < NumVectors; ++v)
+            {
+                VectorStoreAligned(D0[v], Delay0 + v * LanesPerVector);
+                VectorStoreAligned(D1[v], Delay1 + v * LanesPerVector);
+                VectorStoreAligned(Out[v], LaneOutputs + v * LanesPerVector);
+            }
+        }
+
+        for (; Step < NumSteps; ++Step)
+        {
+            PartialStep<NumLanes>(InOutBuffer, NumFrames, Step, Delay0, Delay1, LaneOutputs, Coefficient);
+        }
+    }
+
+    void FAllPassChain::ProcessStage(float* InOutBuffer, int32 NumFrames, int32 Stage)
+    {
+        for (int32 i = 0; i < NumFrames; ++i)
+        {
+            InOutBuffer[i] = TickStage(Stage, InOutBuffer[i]);
+        }
+    }
+}
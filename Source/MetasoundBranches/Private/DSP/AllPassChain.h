@@ -0,0 +1,64 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundBranches/Private/DSP/DSPCore.h"
+#include "MetasoundBranches/Private/DSP/Silence.h"
+#include "MetasoundBranches/Private/DSP/SimdDispatch.h"
+
+namespace MetasoundBranches
+{
+    // A cascade of identical allpass stages, each y[n] = -a * x[n] + x[n-2] + a * y[n-2].
+    //
+    // All stage state lives in one aligned structure-of-arrays block, so processing never allocates.
+    // Stages are pipelined across SIMD lanes: lane j of a group works on stage (K + j) at sample (t - j),
+    // taking its input from lane (j - 1) one step earlier, so four or eight stages advance per vector step
+    // (sixteen with AVX2).
+    class FAllPassChain
+    {
+    public:
+        // Allocate state for up to InMaxStages stages, and pick the widest groups InSimdLevel allows. Call before
+        // the audio thread starts processing.
+        void Init(int32 InMaxStages, float InCoefficient = 0.5f, ESimdLevel InSimdLevel = ESimdLevel::Vector);
+
+        // Clear the state of every stage.
+        void Reset();
+
+        // Run the first NumStages stages over the buffer, in place. Silence into a chain that has rung out is
+        // left as it is.
+        void ProcessInPlace(float* InOutBuffer, int32 NumFrames, int32 NumStages);
+
+        int32 GetMaxStages() const { return MaxStages; }
+
+    private:
+        static constexpr int32 LanesPerVector = 4;
+
+        template<int32 NumLanes>
+        void ProcessGroup(float* InOutBuffer, int32 NumFrames, int32 FirstStage);
+
+        void ProcessStage(float* InOutBuffer, int32 NumFrames, int32 Stage);
+
+        // Advance a single stage by one sample
+        FORCEINLINE float TickStage(int32 Stage, float InSample)
+        {
+            float* Delay0 = State.GetData();
+            float* Delay1 = Delay0 + StateStride;
+
+            const float OutSample = Delay0[Stage] - Coefficient * InSample;
+            Delay0[Stage] = Delay1[Stage];
+            Delay1[Stage] = InSample + Coefficient * OutSample;
+
+            return OutSample;
+        }
+
+        // [x[n-2] + a * y[n-2] for every stage][x[n-1] + a * y[n-1] for every stage]
+        TArray<float, TAlignedHeapAllocator<16>> State;
+        int32 StateStride = 0;
+        int32 MaxStages = 0;
+        float Coefficient = 0.5f;
+        ESimdLevel SimdLevel = ESimdLevel::Vector;
+
+        // Every stage's state is exactly zero
+        bool bIsStateSilent = true;
+    };
+}
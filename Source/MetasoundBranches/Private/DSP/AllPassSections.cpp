@@ -0,0 +1,139 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Private/DSP/AllPassSections.h"
+
+namespace MetasoundBranches
+{
+    namespace AllPassSectionsPrivate
+    {
+        // Build (Carry, Prev[0], Prev[1], Prev[2])
+        FORCEINLINE VectorRegister4Float ShiftIn(const VectorRegister4Float& Carry, const VectorRegister4Float& Prev)
+        {
+            const VectorRegister4Float Low = VectorShuffle(Carry, Prev, 0, 0, 0, 0);
+            return VectorShuffle(Low, Prev, 0, 2, 1, 2);
+        }
+    }
+
+    void FAllPassSectionChain::Init(int32 InMaxSections)
+    {
+        MaxSections = FMath::Max(InMaxSections, 0);
+        StateStride = Align(MaxSections, LanesPerVector);
+
+        State.SetNumZeroed(StateStride * 2);
+        bIsStateSilent = true;
+    }
+
+    void FAllPassSectionChain::Reset()
+    {
+        FMemory::Memzero(State.GetData(), State.Num() * sizeof(float));
+        bIsStateSilent = true;
+    }
+
+    void FAllPassSectionChain::ProcessInPlace(float* InOutBuffer, int32 NumFrames, const FAllPassSectionTable& Table)
+    {
+        const int32 NumSections = FMath::Min(Table.Num(), MaxSections);
+
+        if (NumFrames <= 0 || (bIsStateSilent && IsSilent(InOutBuffer, NumFrames)))
+        {
+            return;
+        }
+
+        FScopedDenormalGuard DenormalGuard;
+
+        int32 Section = 0;
+
+        for (; Section + LanesPerVector <= NumSections; Section += LanesPerVector)
+        {
+            ProcessGroup(InOutBuffer, NumFrames, Section, Table);
+        }
+
+        for (; Section < NumSections; ++Section)
+        {
+            const float A1 = Table.A1[Section];
+            const float A2 = Table.A2[Section];
+
+            for (int32 i = 0; i < NumFrames; ++i)
+            {
+                InOutBuffer[i] = TickSection(Section, InOutBuffer[i], A1, A2);
+            }
+        }
+
+        FlushDenormals(State.GetData(), State.Num());
+        bIsStateSilent = IsSilent(State.GetData(), State.Num());
+    }
+
+    void FAllPassSectionChain::ProcessGroup(float* InOutBuffer, int32 NumFrames, int32 FirstSection, const FAllPassSectionTable& Table)
+    {
+        using namespace AllPassSectionsPrivate;
+
+        static constexpr int32 LastLane = LanesPerVector - 1;
+
+        const float* A1 = Table.A1.GetData() + FirstSection;
+        const float* A2 = Table.A2.GetData() + FirstSection;
+
+        alignas(16) float LaneOutputs[LanesPerVector] = {};
+
+        // Lane j processes frame (t - j) at step t; see FAllPassChain::ProcessGroup
+        auto PartialStep = [&](int32 Step)
+        {
+            for (int32 Lane = LastLane; Lane >= 0; --Lane)
+            {
+                const int32 Frame = Step - Lane;
+
+                if (Frame >= 0 && Frame < NumFrames)
+                {
+                    const float InSample = (Lane == 0) ? InOutBuffer[Frame] : LaneOutputs[Lane - 1];
+                    LaneOutputs[Lane] = TickSection(FirstSection + Lane, InSample, A1[Lane], A2[Lane]);
+
+                    if (Lane == LastLane)
+                    {
+                        InOutBuffer[Frame] = LaneOutputs[Lane];
+                    }
+                }
+            }
+        };
+
+        const int32 NumSteps = NumFrames + LastLane;
+        int32 Step = 0;
+
+        for (; Step < LastLane; ++Step)
+        {
+            PartialStep(Step);
+        }
+
+        if (Step < NumFrames)
+        {
+            float* StateW1 = State.GetData() + FirstSection;
+            float* StateW2 = StateW1 + StateStride;
+
+            const VectorRegister4Float CoefA1 = VectorLoadAligned(A1);
+            const VectorRegister4Float CoefA2 = VectorLoadAligned(A2);
+
+            VectorRegister4Float W1 = VectorLoadAligned(StateW1);
+            VectorRegister4Float W2 = VectorLoadAligned(StateW2);
+            VectorRegister4Float Out = VectorLoadAligned(LaneOutputs);
+
+            for (; Step < NumFrames; ++Step)
+            {
+                const VectorRegister4Float In = ShiftIn(VectorSetFloat1(InOutBuffer[Step]), Out);
+
+                const VectorRegister4Float W = VectorNegateMultiplyAdd(CoefA2, W2, VectorNegateMultiplyAdd(CoefA1, W1, In));
+                Out = VectorMultiplyAdd(CoefA2, W, VectorMultiplyAdd(CoefA1, W1, W2));
+
+                W2 = W1;
+                W1 = W;
+
+                InOutBuffer[Step - LastLane] = VectorGetComponent(Out, 3);
+            }
+
+            VectorStoreAligned(W1, StateW1);
+            VectorStoreAligned(W2, StateW2);
+            VectorStoreAligned(Out, LaneOutputs);
+        }
+
+        for (; Step < NumSteps; ++Step)
+        {
+            PartialStep(Step);
+        }
+    }
+}
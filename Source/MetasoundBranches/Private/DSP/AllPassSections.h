@@ -0,0 +1,62 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundBranches/Private/DSP/DSPCore.h"
+#include "MetasoundBranches/Private/DSP/Silence.h"
+
+namespace MetasoundBranches
+{
+    // Coefficients for a cascade of second-order allpass sections,
+    // H(z) = (a2 + a1 * z^-1 + z^-2) / (1 + a1 * z^-1 + a2 * z^-2), stored as structure-of-arrays.
+    struct FAllPassSectionTable
+    {
+        TArray<float, TAlignedHeapAllocator<16>> A1;
+        TArray<float, TAlignedHeapAllocator<16>> A2;
+
+        int32 Num() const { return A1.Num(); }
+    };
+
+    // Runs a cascade of second-order allpass sections in place.
+    // State is allocated once by Init; the coefficient table is supplied per call so it can be shared.
+    // Like FAllPassChain, sections are pipelined four at a time across SIMD lanes.
+    class FAllPassSectionChain
+    {
+    public:
+        void Init(int32 InMaxSections);
+
+        void Reset();
+
+        // Run min(Table.Num(), max sections) sections over the buffer, in place. Silence into a cascade that has
+        // rung out is left as it is.
+        void ProcessInPlace(float* InOutBuffer, int32 NumFrames, const FAllPassSectionTable& Table);
+
+    private:
+        static constexpr int32 LanesPerVector = 4;
+
+        void ProcessGroup(float* InOutBuffer, int32 NumFrames, int32 FirstSection, const FAllPassSectionTable& Table);
+
+        // Advance a single section by one sample (direct form II)
+        FORCEINLINE float TickSection(int32 Section, float InSample, float A1, float A2)
+        {
+            float* W1 = State.GetData();
+            float* W2 = W1 + StateStride;
+
+            const float W = InSample - A1 * W1[Section] - A2 * W2[Section];
+            const float OutSample = A2 * W + A1 * W1[Section] + W2[Section];
+
+            W2[Section] = W1[Section];
+            W1[Section] = W;
+
+            return OutSample;
+        }
+
+        // [w[n-1] for every section][w[n-2] for every section]
+        TArray<float, TAlignedHeapAllocator<16>> State;
+        int32 StateStride = 0;
+        int32 MaxSections = 0;
+
+        // Every section's state is exactly zero
+        bool bIsStateSilent = true;
+    };
+}
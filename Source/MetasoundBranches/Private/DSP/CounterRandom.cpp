@@ -0,0 +1,54 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Private/DSP/CounterRandom.h"
+
+namespace MetasoundBranches
+{
+    namespace CounterRandomPrivate
+    {
+        FORCEINLINE VectorRegister4Int VectorMix(VectorRegister4Int X)
+        {
+            const VectorRegister4Int M1 = VectorIntSet1(static_cast<int32>(0x7FEB352Du));
+            const VectorRegister4Int M2 = VectorIntSet1(static_cast<int32>(0x846CA68Bu));
+
+            X = VectorIntXor(X, VectorShiftRightImmLogical(X, 16));
+            X = VectorIntMultiply(X, M1);
+            X = VectorIntXor(X, VectorShiftRightImmLogical(X, 15));
+            X = VectorIntMultiply(X, M2);
+            X = VectorIntXor(X, VectorShiftRightImmLogical(X, 16));
+            return X;
+        }
+    }
+
+    void FCounterRandom::GenerateFractions(float* OutFractions, int32 Num)
+    {
+        using namespace CounterRandomPrivate;
+
+        const VectorRegister4Int KeyVector = VectorIntSet1(static_cast<int32>(Key));
+        const VectorRegister4Int Step = VectorIntSet1(4);
+        const VectorRegister4Float Scale = VectorSetFloat1(1.0f / 16777216.0f);
+
+        VectorRegister4Int Counters = MakeVectorRegisterInt(
+            static_cast<int32>(Counter), static_cast<int32>(Counter + 1), static_cast<int32>(Counter + 2), static_cast<int32>(Counter + 3));
+
+        int32 i = 0;
+
+        for (; i + 4 <= Num; i += 4)
+        {
+            const VectorRegister4Int Bits = VectorMix(VectorIntAdd(VectorMix(VectorIntXor(Counters, KeyVector)), KeyVector));
+
+            // Top 24 bits are non-negative as signed integers, so the signed conversion is exact
+            const VectorRegister4Float Fractions = VectorMultiply(VectorIntToFloat(VectorShiftRightImmLogical(Bits, 8)), Scale);
+            VectorStore(Fractions, OutFractions + i);
+
+            Counters = VectorIntAdd(Counters, Step);
+        }
+
+        Counter += i;
+
+        for (; i < Num; ++i)
+        {
+            OutFractions[i] = GetFraction();
+        }
+    }
+}
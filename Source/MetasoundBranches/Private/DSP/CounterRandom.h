@@ -0,0 +1,63 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundBranches/Private/DSP/DSPCore.h"
+
+namespace MetasoundBranches
+{
+    // Counter-based random number generator: the n-th value of a stream is a hash of (seed, n), so values
+    // can be generated independently of each other, four at a time in SIMD lanes, and any seed gives the
+    // same sequence on every platform. The hash is two rounds of an integer avalanche mix (constant shifts,
+    // xors and 32-bit multiplies), which vectorises on SSE and NEON.
+    class FCounterRandom
+    {
+    public:
+        explicit FCounterRandom(uint32 InSeed = 0)
+        {
+            SetSeed(InSeed);
+        }
+
+        // Restart the stream for a seed
+        void SetSeed(uint32 InSeed)
+        {
+            Key = Mix(InSeed ^ 0x9E3779B9u);
+            Counter = 0;
+        }
+
+        // Uniform in [0, 1)
+        float GetFraction()
+        {
+            return ToFraction(Hash(Counter++));
+        }
+
+        // Fill OutFractions with the next Num values of the stream, identical to Num calls to GetFraction()
+        void GenerateFractions(float* OutFractions, int32 Num);
+
+    private:
+        // Avalanche mix (Wellons' "lowbias32")
+        static FORCEINLINE uint32 Mix(uint32 X)
+        {
+            X ^= X >> 16;
+            X *= 0x7FEB352Du;
+            X ^= X >> 15;
+            X *= 0x846CA68Bu;
+            X ^= X >> 16;
+            return X;
+        }
+
+        FORCEINLINE uint32 Hash(uint32 InCounter) const
+        {
+            return Mix(Mix(InCounter ^ Key) + Key);
+        }
+
+        // Top 24 bits as a float in [0, 1)
+        static FORCEINLINE float ToFraction(uint32 Bits)
+        {
+            return static_cast<float>(Bits >> 8) * (1.0f / 16777216.0f);
+        }
+
+        uint32 Key = 0;
+        uint32 Counter = 0;
+    };
+}
@@ -0,0 +1,503 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+// Platform layer for the DSP kernels in this folder.
+//
+// In the plugin this is just the engine headers the kernels use. Compiled with METASOUNDBRANCHES_DSP_STANDALONE=1
+// it supplies the same small subset of the Core API instead, in plain C++ over SSE, NEON or scalar code, so the
+// kernels build and can be measured outside the engine. Kernels must stick to what is declared here: integer
+// types, FMath, FMemory, Align, an aligned TArray, TArrayView, Audio::ArraySetToConstantInplace and the
+// VectorRegister functions below.
+
+#ifndef METASOUNDBRANCHES_DSP_STANDALONE
+#define METASOUNDBRANCHES_DSP_STANDALONE 0
+#endif
+
+#if !METASOUNDBRANCHES_DSP_STANDALONE
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+#include "DSP/FloatArrayMath.h"
+
+#else
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// METASOUNDBRANCHES_DSP_SCALAR=1 selects the plain C++ vector fallback on any target
+#if defined(METASOUNDBRANCHES_DSP_SCALAR) && METASOUNDBRANCHES_DSP_SCALAR
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define METASOUNDBRANCHES_DSP_SSE 1
+#include <emmintrin.h>
+#if defined(__SSE4_1__) || defined(__AVX__)
+#include <smmintrin.h>
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define METASOUNDBRANCHES_DSP_NEON 1
+#include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER)
+#define FORCEINLINE __forceinline
+#else
+#define FORCEINLINE inline __attribute__((always_inline))
+#endif
+
+#define INDEX_NONE (-1)
+#define UE_PI (3.1415926535897932f)
+#define UE_HALF_PI (1.57079632679f)
+#define UE_DOUBLE_PI (3.141592653589793238462643383279502884197169399)
+#define UE_INV_LN2 (1.4426950408889634f)
+#define UE_SMALL_NUMBER (1.e-8f)
+
+using int8 = std::int8_t;
+using uint8 = std::uint8_t;
+using int32 = std::int32_t;
+using uint32 = std::uint32_t;
+using int64 = std::int64_t;
+using uint64 = std::uint64_t;
+
+struct FMath
+{
+    template<typename T> static constexpr T Max(T A, T B) { return (A > B) ? A : B; }
+    template<typename T> static constexpr T Min(T A, T B) { return (A < B) ? A : B; }
+    template<typename T> static constexpr T Clamp(T X, T Lo, T Hi) { return (X < Lo) ? Lo : ((X > Hi) ? Hi : X); }
+    template<typename T> static constexpr T Abs(T X) { return (X < T(0)) ? -X : X; }
+    template<typename T, typename U> static constexpr T Lerp(T A, T B, U Alpha) { return static_cast<T>(A + Alpha * (B - A)); }
+
+    static FORCEINLINE float Exp(float X) { return std::exp(X); }
+    static FORCEINLINE double Exp(double X) { return std::exp(X); }
+    static FORCEINLINE float Loge(float X) { return std::log(X); }
+    static FORCEINLINE double Loge(double X) { return std::log(X); }
+    static FORCEINLINE float Sin(float X) { return std::sin(X); }
+    static FORCEINLINE double Sin(double X) { return std::sin(X); }
+    static FORCEINLINE float Cos(float X) { return std::cos(X); }
+    static FORCEINLINE double Cos(double X) { return std::cos(X); }
+    static FORCEINLINE float Sqrt(float X) { return std::sqrt(X); }
+    static FORCEINLINE float FloorToFloat(float X) { return std::floor(X); }
+    static FORCEINLINE int32 FloorToInt(float X) { return static_cast<int32>(std::floor(X)); }
+    static FORCEINLINE int32 RoundToInt(float X) { return FloorToInt(X + 0.5f); }
+
+    // Undefined for zero, as the engine's version is only meaningful for non-zero values here
+    static FORCEINLINE uint32 CountTrailingZeros(uint32 Value)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long Index;
+        _BitScanForward(&Index, Value);
+        return static_cast<uint32>(Index);
+#else
+        return static_cast<uint32>(__builtin_ctz(Value));
+#endif
+    }
+};
+
+struct FMemory
+{
+    static FORCEINLINE void* Memcpy(void* Dest, const void* Src, size_t Count) { return std::memcpy(Dest, Src, Count); }
+    static FORCEINLINE void* Memzero(void* Dest, size_t Count) { return std::memset(Dest, 0, Count); }
+};
+
+template<typename T>
+constexpr T Align(T Value, uint64 Alignment)
+{
+    return static_cast<T>((static_cast<uint64>(Value) + Alignment - 1) & ~(Alignment - 1));
+}
+
+struct FDefaultAllocator {};
+
+template<uint32 Alignment>
+struct TAlignedHeapAllocator {};
+
+// Owning, resizable array with the TArray calls the kernels use; storage is always 16-byte aligned
+template<typename T, typename AllocatorType = FDefaultAllocator>
+class TArray
+{
+public:
+    TArray() = default;
+
+    TArray(const TArray& Other)
+    {
+        *this = Other;
+    }
+
+    TArray(TArray&& Other) noexcept
+        : Data(Other.Data)
+        , ArrayNum(Other.ArrayNum)
+    {
+        Other.Data = nullptr;
+        Other.ArrayNum = 0;
+    }
+
+    ~TArray()
+    {
+        Free();
+    }
+
+    TArray& operator=(const TArray& Other)
+    {
+        if (this != &Other)
+        {
+            SetNumZeroed(Other.ArrayNum);
+            for (int32 i = 0; i < ArrayNum; ++i)
+            {
+                Data[i] = Other.Data[i];
+            }
+        }
+        return *this;
+    }
+
+    TArray& operator=(TArray&& Other) noexcept
+    {
+        std::swap(Data, Other.Data);
+        std::swap(ArrayNum, Other.ArrayNum);
+        return *this;
+    }
+
+    void SetNumZeroed(int32 NewNum)
+    {
+        Free();
+
+        if (NewNum > 0)
+        {
+            Data = static_cast<T*>(::operator new(sizeof(T) * NewNum, std::align_val_t(16)));
+            for (int32 i = 0; i < NewNum; ++i)
+            {
+                new (Data + i) T();
+            }
+            ArrayNum = NewNum;
+        }
+    }
+
+    int32 Num() const { return ArrayNum; }
+    bool IsEmpty() const { return ArrayNum == 0; }
+
+    T* GetData() { return Data; }
+    const T* GetData() const { return Data; }
+
+    T& operator[](int32 Index) { return Data[Index]; }
+    const T& operator[](int32 Index) const { return Data[Index]; }
+
+private:
+    void Free()
+    {
+        for (int32 i = 0; i < ArrayNum; ++i)
+        {
+            Data[i].~T();
+        }
+        ::operator delete(Data, std::align_val_t(16));
+        Data = nullptr;
+        ArrayNum = 0;
+    }
+
+    T* Data = nullptr;
+    int32 ArrayNum = 0;
+};
+
+template<typename T>
+class TArrayView
+{
+public:
+    TArrayView(T* InData, int32 InNum) : Data(InData), ArrayNum(InNum) {}
+
+    int32 Num() const { return ArrayNum; }
+    T* GetData() const { return Data; }
+
+private:
+    T* Data;
+    int32 ArrayNum;
+};
+
+namespace Audio
+{
+    inline void ArraySetToConstantInplace(TArrayView<float> InValues, float InValue)
+    {
+        float* Data = InValues.GetData();
+        for (int32 i = 0; i < InValues.Num(); ++i)
+        {
+            Data[i] = InValue;
+        }
+    }
+}
+
+#if METASOUNDBRANCHES_DSP_SSE
+
+using VectorRegister4Float = __m128;
+using VectorRegister4Int = __m128i;
+
+FORCEINLINE VectorRegister4Float VectorLoad(const float* Ptr) { return _mm_loadu_ps(Ptr); }
+FORCEINLINE VectorRegister4Float VectorLoadAligned(const float* Ptr) { return _mm_load_ps(Ptr); }
+FORCEINLINE void VectorStore(const VectorRegister4Float& Vec, float* Ptr) { _mm_storeu_ps(Ptr, Vec); }
+FORCEINLINE void VectorStoreAligned(const VectorRegister4Float& Vec, float* Ptr) { _mm_store_ps(Ptr, Vec); }
+FORCEINLINE VectorRegister4Float VectorSetFloat1(float X) { return _mm_set1_ps(X); }
+FORCEINLINE VectorRegister4Float VectorAdd(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_add_ps(A, B); }
+FORCEINLINE VectorRegister4Float VectorSubtract(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_sub_ps(A, B); }
+FORCEINLINE VectorRegister4Float VectorMultiply(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_mul_ps(A, B); }
+FORCEINLINE VectorRegister4Float VectorMultiplyAdd(const VectorRegister4Float& A, const VectorRegister4Float& B, const VectorRegister4Float& C) { return _mm_add_ps(_mm_mul_ps(A, B), C); }
+FORCEINLINE VectorRegister4Float VectorNegateMultiplyAdd(const VectorRegister4Float& A, const VectorRegister4Float& B, const VectorRegister4Float& C) { return _mm_sub_ps(C, _mm_mul_ps(A, B)); }
+FORCEINLINE VectorRegister4Float VectorAbs(const VectorRegister4Float& Vec) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), Vec); }
+FORCEINLINE VectorRegister4Float VectorMax(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_max_ps(A, B); }
+FORCEINLINE VectorRegister4Float VectorMin(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_min_ps(A, B); }
+FORCEINLINE int32 VectorAnyGreaterThan(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_movemask_ps(_mm_cmpgt_ps(A, B)); }
+FORCEINLINE VectorRegister4Float VectorCompareGT(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_cmpgt_ps(A, B); }
+FORCEINLINE VectorRegister4Float VectorCompareGE(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_cmpge_ps(A, B); }
+FORCEINLINE VectorRegister4Float VectorBitwiseAnd(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_and_ps(A, B); }
+FORCEINLINE VectorRegister4Float VectorBitwiseOr(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_or_ps(A, B); }
+FORCEINLINE uint32 VectorMaskBits(const VectorRegister4Float& Vec) { return static_cast<uint32>(_mm_movemask_ps(Vec)); }
+
+#define VectorShuffle(Vec1, Vec2, X, Y, Z, W) _mm_shuffle_ps(Vec1, Vec2, _MM_SHUFFLE(W, Z, Y, X))
+
+FORCEINLINE VectorRegister4Int VectorIntSet1(int32 X) { return _mm_set1_epi32(X); }
+FORCEINLINE VectorRegister4Int MakeVectorRegisterInt(int32 X, int32 Y, int32 Z, int32 W) { return _mm_setr_epi32(X, Y, Z, W); }
+FORCEINLINE VectorRegister4Int VectorIntAdd(const VectorRegister4Int& A, const VectorRegister4Int& B) { return _mm_add_epi32(A, B); }
+FORCEINLINE VectorRegister4Int VectorIntXor(const VectorRegister4Int& A, const VectorRegister4Int& B) { return _mm_xor_si128(A, B); }
+FORCEINLINE VectorRegister4Int VectorShiftRightImmLogical(const VectorRegister4Int& Vec, int32 Shift) { return _mm_srl_epi32(Vec, _mm_cvtsi32_si128(Shift)); }
+FORCEINLINE VectorRegister4Float VectorIntToFloat(const VectorRegister4Int& Vec) { return _mm_cvtepi32_ps(Vec); }
+
+FORCEINLINE VectorRegister4Int VectorIntMultiply(const VectorRegister4Int& A, const VectorRegister4Int& B)
+{
+#if defined(__SSE4_1__) || defined(__AVX__)
+    return _mm_mullo_epi32(A, B);
+#else
+    // Low 32 bits of each product from two 32x32->64 multiplies of the even and odd lanes
+    const __m128i Even = _mm_mul_epu32(A, B);
+    const __m128i Odd = _mm_mul_epu32(_mm_srli_si128(A, 4), _mm_srli_si128(B, 4));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(Even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(Odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
+}
+
+#elif METASOUNDBRANCHES_DSP_NEON
+
+using VectorRegister4Float = float32x4_t;
+using VectorRegister4Int = int32x4_t;
+
+FORCEINLINE VectorRegister4Float VectorLoad(const float* Ptr) { return vld1q_f32(Ptr); }
+FORCEINLINE VectorRegister4Float VectorLoadAligned(const float* Ptr) { return vld1q_f32(Ptr); }
+FORCEINLINE void VectorStore(const VectorRegister4Float& Vec, float* Ptr) { vst1q_f32(Ptr, Vec); }
+FORCEINLINE void VectorStoreAligned(const VectorRegister4Float& Vec, float* Ptr) { vst1q_f32(Ptr, Vec); }
+FORCEINLINE VectorRegister4Float VectorSetFloat1(float X) { return vdupq_n_f32(X); }
+FORCEINLINE VectorRegister4Float VectorAdd(const VectorRegister4Float& A, const VectorRegister4Float& B) { return vaddq_f32(A, B); }
+FORCEINLINE VectorRegister4Float VectorSubtract(const VectorRegister4Float& A, const VectorRegister4Float& B) { return vsubq_f32(A, B); }
+FORCEINLINE VectorRegister4Float VectorMultiply(const VectorRegister4Float& A, const VectorRegister4Float& B) { return vmulq_f32(A, B); }
+FORCEINLINE VectorRegister4Float VectorMultiplyAdd(const VectorRegister4Float& A, const VectorRegister4Float& B, const VectorRegister4Float& C) { return vmlaq_f32(C, A, B); }
+FORCEINLINE VectorRegister4Float VectorNegateMultiplyAdd(const VectorRegister4Float& A, const VectorRegister4Float& B, const VectorRegister4Float& C) { return vmlsq_f32(C, A, B); }
+FORCEINLINE VectorRegister4Float VectorAbs(const VectorRegister4Float& Vec) { return vabsq_f32(Vec); }
+FORCEINLINE VectorRegister4Float VectorMax(const VectorRegister4Float& A, const VectorRegister4Float& B) { return vmaxq_f32(A, B); }
+FORCEINLINE VectorRegister4Float VectorMin(const VectorRegister4Float& A, const VectorRegister4Float& B) { return vminq_f32(A, B); }
+
+FORCEINLINE int32 VectorAnyGreaterThan(const VectorRegister4Float& A, const VectorRegister4Float& B)
+{
+    const uint32x4_t Mask = vcgtq_f32(A, B);
+    const uint32x2_t Half = vorr_u32(vget_low_u32(Mask), vget_high_u32(Mask));
+    return static_cast<int32>(vget_lane_u32(vpmax_u32(Half, Half), 0));
+}
+
+FORCEINLINE VectorRegister4Float VectorCompareGT(const VectorRegister4Float& A, const VectorRegister4Float& B) { return vreinterpretq_f32_u32(vcgtq_f32(A, B)); }
+FORCEINLINE VectorRegister4Float VectorCompareGE(const VectorRegister4Float& A, const VectorRegister4Float& B) { return vreinterpretq_f32_u32(vcgeq_f32(A, B)); }
+FORCEINLINE VectorRegister4Float VectorBitwiseAnd(const VectorRegister4Float& A, const VectorRegister4Float& B) { return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(A), vreinterpretq_u32_f32(B))); }
+FORCEINLINE VectorRegister4Float VectorBitwiseOr(const VectorRegister4Float& A, const VectorRegister4Float& B) { return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(A), vreinterpretq_u32_f32(B))); }
+
+// Sign bit of each lane, lane 0 in bit 0
+FORCEINLINE uint32 VectorMaskBits(const VectorRegister4Float& Vec)
+{
+    static const int32 LaneShifts[4] = { 0, 1, 2, 3 };
+    const uint32x4_t Bits = vshlq_u32(vshrq_n_u32(vreinterpretq_u32_f32(Vec), 31), vld1q_s32(LaneShifts));
+    const uint32x2_t Sum = vadd_u32(vget_low_u32(Bits), vget_high_u32(Bits));
+    return vget_lane_u32(vpadd_u32(Sum, Sum), 0);
+}
+
+template<int X, int Y, int Z, int W>
+FORCEINLINE VectorRegister4Float VectorShuffleImpl(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    VectorRegister4Float Result = vdupq_n_f32(vgetq_lane_f32(Vec1, X));
+    Result = vsetq_lane_f32(vgetq_lane_f32(Vec1, Y), Result, 1);
+    Result = vsetq_lane_f32(vgetq_lane_f32(Vec2, Z), Result, 2);
+    return vsetq_lane_f32(vgetq_lane_f32(Vec2, W), Result, 3);
+}
+
+#define VectorShuffle(Vec1, Vec2, X, Y, Z, W) VectorShuffleImpl<X, Y, Z, W>(Vec1, Vec2)
+
+FORCEINLINE VectorRegister4Int VectorIntSet1(int32 X) { return vdupq_n_s32(X); }
+FORCEINLINE VectorRegister4Int MakeVectorRegisterInt(int32 X, int32 Y, int32 Z, int32 W) { const int32 Values[4] = { X, Y, Z, W }; return vld1q_s32(Values); }
+FORCEINLINE VectorRegister4Int VectorIntAdd(const VectorRegister4Int& A, const VectorRegister4Int& B) { return vaddq_s32(A, B); }
+FORCEINLINE VectorRegister4Int VectorIntXor(const VectorRegister4Int& A, const VectorRegister4Int& B) { return veorq_s32(A, B); }
+FORCEINLINE VectorRegister4Int VectorIntMultiply(const VectorRegister4Int& A, const VectorRegister4Int& B) { return vmulq_s32(A, B); }
+FORCEINLINE VectorRegister4Int VectorShiftRightImmLogical(const VectorRegister4Int& Vec, int32 Shift) { return vreinterpretq_s32_u32(vshlq_u32(vreinterpretq_u32_s32(Vec), vdupq_n_s32(-Shift))); }
+FORCEINLINE VectorRegister4Float VectorIntToFloat(const VectorRegister4Int& Vec) { return vcvtq_f32_s32(Vec); }
+
+#else
+
+struct VectorRegister4Float { float V[4]; };
+struct VectorRegister4Int { int32 V[4]; };
+
+#define METASOUNDBRANCHES_DSP_LANEWISE(Expression) VectorRegister4Float Result; for (int32 i = 0; i < 4; ++i) { Result.V[i] = (Expression); } return Result;
+#define METASOUNDBRANCHES_DSP_INT_LANEWISE(Expression) VectorRegister4Int Result; for (int32 i = 0; i < 4; ++i) { Result.V[i] = (Expression); } return Result;
+
+FORCEINLINE VectorRegister4Float VectorLoad(const float* Ptr) { METASOUNDBRANCHES_DSP_LANEWISE(Ptr[i]) }
+FORCEINLINE VectorRegister4Float VectorLoadAligned(const float* Ptr) { METASOUNDBRANCHES_DSP_LANEWISE(Ptr[i]) }
+FORCEINLINE void VectorStore(const VectorRegister4Float& Vec, float* Ptr) { for (int32 i = 0; i < 4; ++i) { Ptr[i] = Vec.V[i]; } }
+FORCEINLINE void VectorStoreAligned(const VectorRegister4Float& Vec, float* Ptr) { VectorStore(Vec, Ptr); }
+FORCEINLINE VectorRegister4Float VectorSetFloat1(float X) { METASOUNDBRANCHES_DSP_LANEWISE(X) }
+FORCEINLINE VectorRegister4Float VectorAdd(const VectorRegister4Float& A, const VectorRegister4Float& B) { METASOUNDBRANCHES_DSP_LANEWISE(A.V[i] + B.V[i]) }
+FORCEINLINE VectorRegister4Float VectorSubtract(const VectorRegister4Float& A, const VectorRegister4Float& B) { METASOUNDBRANCHES_DSP_LANEWISE(A.V[i] - B.V[i]) }
+FORCEINLINE VectorRegister4Float VectorMultiply(const VectorRegister4Float& A, const VectorRegister4Float& B) { METASOUNDBRANCHES_DSP_LANEWISE(A.V[i] * B.V[i]) }
+FORCEINLINE VectorRegister4Float VectorMultiplyAdd(const VectorRegister4Float& A, const VectorRegister4Float& B, const VectorRegister4Float& C) { METASOUNDBRANCHES_DSP_LANEWISE(A.V[i] * B.V[i] + C.V[i]) }
+FORCEINLINE VectorRegister4Float VectorNegateMultiplyAdd(const VectorRegister4Float& A, const VectorRegister4Float& B, const VectorRegister4Float& C) { METASOUNDBRANCHES_DSP_LANEWISE(C.V[i] - A.V[i] * B.V[i]) }
+FORCEINLINE VectorRegister4Float VectorAbs(const VectorRegister4Float& Vec) { METASOUNDBRANCHES_DSP_LANEWISE(std::fabs(Vec.V[i])) }
+FORCEINLINE VectorRegister4Float VectorMax(const VectorRegister4Float& A, const VectorRegister4Float& B) { METASOUNDBRANCHES_DSP_LANEWISE((A.V[i] > B.V[i]) ? A.V[i] : B.V[i]) }
+FORCEINLINE VectorRegister4Float VectorMin(const VectorRegister4Float& A, const VectorRegister4Float& B) { METASOUNDBRANCHES_DSP_LANEWISE((A.V[i] < B.V[i]) ? A.V[i] : B.V[i]) }
+FORCEINLINE int32 VectorAnyGreaterThan(const VectorRegister4Float& A, const VectorRegister4Float& B) { return (A.V[0] > B.V[0]) | (A.V[1] > B.V[1]) | (A.V[2] > B.V[2]) | (A.V[3] > B.V[3]); }
+
+// Comparison results and bitwise operations work on the lanes' bit patterns, as in the SIMD versions
+FORCEINLINE uint32 VectorLaneBits(float X) { uint32 Bits; std::memcpy(&Bits, &X, sizeof(Bits)); return Bits; }
+FORCEINLINE float VectorLaneFromBits(uint32 Bits) { float X; std::memcpy(&X, &Bits, sizeof(X)); return X; }
+
+FORCEINLINE VectorRegister4Float VectorCompareGT(const VectorRegister4Float& A, const VectorRegister4Float& B) { METASOUNDBRANCHES_DSP_LANEWISE(VectorLaneFromBits((A.V[i] > B.V[i]) ? ~0u : 0u)) }
+FORCEINLINE VectorRegister4Float VectorCompareGE(const VectorRegister4Float& A, const VectorRegister4Float& B) { METASOUNDBRANCHES_DSP_LANEWISE(VectorLaneFromBits((A.V[i] >= B.V[i]) ? ~0u : 0u)) }
+FORCEINLINE VectorRegister4Float VectorBitwiseAnd(const VectorRegister4Float& A, const VectorRegister4Float& B) { METASOUNDBRANCHES_DSP_LANEWISE(VectorLaneFromBits(VectorLaneBits(A.V[i]) & VectorLaneBits(B.V[i]))) }
+FORCEINLINE VectorRegister4Float VectorBitwiseOr(const VectorRegister4Float& A, const VectorRegister4Float& B) { METASOUNDBRANCHES_DSP_LANEWISE(VectorLaneFromBits(VectorLaneBits(A.V[i]) | VectorLaneBits(B.V[i]))) }
+FORCEINLINE uint32 VectorMaskBits(const VectorRegister4Float& Vec) { return (VectorLaneBits(Vec.V[0]) >> 31) | ((VectorLaneBits(Vec.V[1]) >> 31) << 1) | ((VectorLaneBits(Vec.V[2]) >> 31) << 2) | ((VectorLaneBits(Vec.V[3]) >> 31) << 3); }
+
+template<int X, int Y, int Z, int W>
+FORCEINLINE VectorRegister4Float VectorShuffleImpl(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return VectorRegister4Float{ { Vec1.V[X], Vec1.V[Y], Vec2.V[Z], Vec2.V[W] } };
+}
+
+#define VectorShuffle(Vec1, Vec2, X, Y, Z, W) VectorShuffleImpl<X, Y, Z, W>(Vec1, Vec2)
+
+FORCEINLINE VectorRegister4Int VectorIntSet1(int32 X) { METASOUNDBRANCHES_DSP_INT_LANEWISE(X) }
+FORCEINLINE VectorRegister4Int MakeVectorRegisterInt(int32 X, int32 Y, int32 Z, int32 W) { return VectorRegister4Int{ { X, Y, Z, W } }; }
+FORCEINLINE VectorRegister4Int VectorIntAdd(const VectorRegister4Int& A, const VectorRegister4Int& B) { METASOUNDBRANCHES_DSP_INT_LANEWISE(static_cast<int32>(static_cast<uint32>(A.V[i]) + static_cast<uint32>(B.V[i]))) }
+FORCEINLINE VectorRegister4Int VectorIntXor(const VectorRegister4Int& A, const VectorRegister4Int& B) { METASOUNDBRANCHES_DSP_INT_LANEWISE(A.V[i] ^ B.V[i]) }
+FORCEINLINE VectorRegister4Int VectorIntMultiply(const VectorRegister4Int& A, const VectorRegister4Int& B) { METASOUNDBRANCHES_DSP_INT_LANEWISE(static_cast<int32>(static_cast<uint32>(A.V[i]) * static_cast<uint32>(B.V[i]))) }
+FORCEINLINE VectorRegister4Int VectorShiftRightImmLogical(const VectorRegister4Int& Vec, int32 Shift) { METASOUNDBRANCHES_DSP_INT_LANEWISE(static_cast<int32>(static_cast<uint32>(Vec.V[i]) >> Shift)) }
+FORCEINLINE VectorRegister4Float VectorIntToFloat(const VectorRegister4Int& Vec) { METASOUNDBRANCHES_DSP_LANEWISE(static_cast<float>(Vec.V[i])) }
+
+#undef METASOUNDBRANCHES_DSP_LANEWISE
+#undef METASOUNDBRANCHES_DSP_INT_LANEWISE
+
+#endif
+
+FORCEINLINE float VectorGetComponent(const VectorRegister4Float& Vec, int32 Index)
+{
+    alignas(16) float Components[4];
+    VectorStoreAligned(Vec, Components);
+    return Components[Index];
+}
+
+#endif
+
+// Floating-point control for the recursive kernels, in both builds. Picked by target rather than by the vector
+// path above, so a scalar build on x86 or ARM64 still gets it.
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define METASOUNDBRANCHES_DSP_MXCSR 1
+#include <xmmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define METASOUNDBRANCHES_DSP_FPCR 1
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+namespace MetasoundBranches
+{
+    // Flushes subnormal results and operands to zero for the lifetime of the scope, then restores the thread's
+    // previous mode. Feedback filters decaying towards silence otherwise spend hundreds of cycles per operation
+    // on subnormal state. Put one around a whole block, not a sample: changing the mode is not free, so it is
+    // only written when it differs. A no-op on targets without such a mode.
+    class FScopedDenormalGuard
+    {
+    public:
+        FScopedDenormalGuard()
+        {
+#if defined(METASOUNDBRANCHES_DSP_MXCSR)
+            // Flush-to-zero (bit 15) and denormals-are-zero (bit 6)
+            static constexpr uint32 FlushMask = 0x8040;
+
+            SavedMode = _mm_getcsr();
+            if ((SavedMode & FlushMask) != FlushMask)
+            {
+                _mm_setcsr(SavedMode | FlushMask);
+                bRestore = true;
+            }
+#elif defined(METASOUNDBRANCHES_DSP_FPCR)
+            // FZ (bit 24) covers both results and operands
+            static constexpr uint64 FlushMask = uint64(1) << 24;
+
+            SavedMode = ReadFPCR();
+            if ((SavedMode & FlushMask) == 0)
+            {
+                WriteFPCR(SavedMode | FlushMask);
+                bRestore = true;
+            }
+#endif
+        }
+
+        ~FScopedDenormalGuard()
+        {
+#if defined(METASOUNDBRANCHES_DSP_MXCSR)
+            if (bRestore)
+            {
+                _mm_setcsr(SavedMode);
+            }
+#elif defined(METASOUNDBRANCHES_DSP_FPCR)
+            if (bRestore)
+            {
+                WriteFPCR(SavedMode);
+            }
+#endif
+        }
+
+        FScopedDenormalGuard(const FScopedDenormalGuard&) = delete;
+        FScopedDenormalGuard& operator=(const FScopedDenormalGuard&) = delete;
+
+    private:
+#if defined(METASOUNDBRANCHES_DSP_MXCSR)
+        uint32 SavedMode = 0;
+        bool bRestore = false;
+#elif defined(METASOUNDBRANCHES_DSP_FPCR)
+        static FORCEINLINE uint64 ReadFPCR()
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return static_cast<uint64>(_ReadStatusReg(ARM64_FPCR));
+#else
+            uint64 Value;
+            __asm__ __volatile__("mrs %0, fpcr" : "=r"(Value));
+            return Value;
+#endif
+        }
+
+        static FORCEINLINE void WriteFPCR(uint64 Value)
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            _WriteStatusReg(ARM64_FPCR, static_cast<__int64>(Value));
+#else
+            __asm__ __volatile__("msr fpcr, %0" : : "r"(Value));
+#endif
+        }
+
+        uint64 SavedMode = 0;
+        bool bRestore = false;
+#endif
+    };
+
+    // Recursive state below this (-300 dB) is cleared at the end of each block, so a filter left ringing into
+    // silence reaches exact zero even where the guard above does nothing, and hands no subnormals to code
+    // running without it.
+    constexpr float DenormalFlushThreshold = 1.0e-15f;
+
+    FORCEINLINE void FlushDenormals(float* InOutData, int32 Num)
+    {
+        for (int32 i = 0; i < Num; ++i)
+        {
+            InOutData[i] = (FMath::Abs(InOutData[i]) < DenormalFlushThreshold) ? 0.0f : InOutData[i];
+        }
+    }
+}
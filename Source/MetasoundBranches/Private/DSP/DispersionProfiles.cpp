@@ -0,0 +1,145 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Private/DSP/DispersionProfiles.h"
+#include "Algo/BinarySearch.h"
+#include "Containers/Map.h"
+#include "Misc/ScopeLock.h"
+
+namespace MetasoundBranches
+{
+    namespace DispersionProfilesPrivate
+    {
+        // Resolution of the group delay curve used when placing sections
+        constexpr int32 NumDesignPoints = 2048;
+
+        // Section bandwidth relative to the band it covers; higher values give narrower, less overlapping sections
+        constexpr double BandwidthScale = 1.5;
+
+        // Relative group delay of each profile at a frequency in Hz. Only the shape matters; the total is normalised.
+        double ProfileGroupDelay(EDispersionProfile Profile, double Frequency)
+        {
+            switch (Profile)
+            {
+                case EDispersionProfile::Smear:
+                {
+                    // One classic stage at 48kHz: (1 - a^2) / (1 - 2a cos(2w) + a^2), a = 0.5
+                    const double Omega = 2.0 * UE_DOUBLE_PI * Frequency / 48000.0;
+                    return 0.75 / (1.25 - FMath::Cos(2.0 * Omega));
+                }
+
+                case EDispersionProfile::Chirp:
+                    return 1.0 / (1.0 + Frequency / 400.0);
+
+                case EDispersionProfile::Spring:
+                    return (Frequency < 4000.0)
+                        ? 0.2 + Frequency / 4000.0
+                        : 1.2 * FMath::Exp(-(Frequency - 4000.0) / 1500.0);
+
+                default:
+                    return 0.0;
+            }
+        }
+
+        double ProfileMaxFrequency(EDispersionProfile Profile)
+        {
+            return (Profile == EDispersionProfile::Spring) ? 10000.0 : 16000.0;
+        }
+
+        // Frequency (rad/sample) at which the cumulative phase reaches Target, by linear interpolation
+        double FindPhase(const TArray<double>& Phase, const TArray<double>& Omega, double Target)
+        {
+            const int32 Index = Algo::LowerBound(Phase, Target);
+
+            if (Index <= 0)
+            {
+                return Omega[0];
+            }
+            if (Index >= Phase.Num())
+            {
+                return Omega.Last();
+            }
+
+            const double Span = Phase[Index] - Phase[Index - 1];
+            const double Alpha = (Span > 0.0) ? (Target - Phase[Index - 1]) / Span : 0.0;
+
+            return FMath::Lerp(Omega[Index - 1], Omega[Index], Alpha);
+        }
+
+        TSharedRef<const FAllPassSectionTable> DesignTable(EDispersionProfile Profile, float SampleRate)
+        {
+            TSharedRef<FAllPassSectionTable> Table = MakeShared<FAllPassSectionTable>();
+
+            if (Profile == EDispersionProfile::Classic || SampleRate <= 0.0f)
+            {
+                return Table;
+            }
+
+            const int32 NumSections = FDispersionProfiles::NumSections;
+            const double MaxFrequency = FMath::Min(ProfileMaxFrequency(Profile), 0.45 * SampleRate);
+
+            // Integrate the group delay curve to get the phase it implies across the band
+            TArray<double> Omega;
+            TArray<double> Phase;
+            Omega.SetNumUninitialized(NumDesignPoints);
+            Phase.SetNumUninitialized(NumDesignPoints);
+
+            double PreviousDelay = ProfileGroupDelay(Profile, 0.0);
+            Omega[0] = 0.0;
+            Phase[0] = 0.0;
+
+            for (int32 i = 1; i < NumDesignPoints; ++i)
+            {
+                const double Frequency = MaxFrequency * i / (NumDesignPoints - 1);
+                const double Delay = ProfileGroupDelay(Profile, Frequency);
+
+                Omega[i] = 2.0 * UE_DOUBLE_PI * Frequency / SampleRate;
+                Phase[i] = Phase[i - 1] + 0.5 * (Delay + PreviousDelay) * (Omega[i] - Omega[i - 1]);
+
+                PreviousDelay = Delay;
+            }
+
+            // Scale so the whole band holds exactly one section's worth of phase (2*pi) per section
+            const double PhaseScale = (2.0 * UE_DOUBLE_PI * NumSections) / Phase.Last();
+            for (double& Value : Phase)
+            {
+                Value *= PhaseScale;
+            }
+
+            Table->A1.SetNumUninitialized(NumSections);
+            Table->A2.SetNumUninitialized(NumSections);
+
+            for (int32 Section = 0; Section < NumSections; ++Section)
+            {
+                const double BandStart = FindPhase(Phase, Omega, 2.0 * UE_DOUBLE_PI * Section);
+                const double BandEnd = FindPhase(Phase, Omega, 2.0 * UE_DOUBLE_PI * (Section + 1));
+                const double Centre = FindPhase(Phase, Omega, 2.0 * UE_DOUBLE_PI * (Section + 0.5));
+
+                const double Radius = FMath::Exp(-0.5 * BandwidthScale * (BandEnd - BandStart));
+
+                Table->A1[Section] = static_cast<float>(-2.0 * Radius * FMath::Cos(Centre));
+                Table->A2[Section] = static_cast<float>(Radius * Radius);
+            }
+
+            return Table;
+        }
+    }
+
+    TSharedRef<const FAllPassSectionTable> FDispersionProfiles::Get(EDispersionProfile Profile, float SampleRate)
+    {
+        using namespace DispersionProfilesPrivate;
+
+        static FCriticalSection CacheCritSec;
+        static TMap<uint64, TSharedRef<const FAllPassSectionTable>> Cache;
+
+        const uint64 Key = (static_cast<uint64>(Profile) << 32) | static_cast<uint32>(FMath::RoundToInt(SampleRate));
+
+        FScopeLock Lock(&CacheCritSec);
+
+        if (const TSharedRef<const FAllPassSectionTable>* Existing = Cache.Find(Key))
+        {
+            return *Existing;
+        }
+
+        return Cache.Add(Key, DesignTable(Profile, SampleRate));
+    }
+}
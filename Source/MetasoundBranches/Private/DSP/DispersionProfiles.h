@@ -0,0 +1,42 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundBranches/Private/DSP/DSPCore.h"
+#include "MetasoundBranches/Private/DSP/AllPassSections.h"
+#include "Templates/SharedPointer.h"
+
+namespace MetasoundBranches
+{
+    enum class EDispersionProfile : int32
+    {
+        // The original cascade of identical allpass stages
+        Classic = 0,
+
+        // The group delay curve of the classic cascade (as heard at 48kHz), limited to the audible band
+        Smear,
+
+        // Low frequencies delayed the most, falling away towards the top of the band
+        Chirp,
+
+        // Group delay rising up to ~4kHz and falling off above, in the manner of a spring tank
+        Spring,
+
+        Num
+    };
+
+    // Second-order allpass sections fitted to a target group delay curve.
+    //
+    // Each section contributes 2*pi of phase across the band, so the curve is split into bands of equal
+    // integrated group delay and one section is centred in each (after Abel & Smith, "Robust design of
+    // very high-order allpass dispersion filters", DAFx 2006). Tables are built once per sample rate and
+    // shared between every operator that asks for them.
+    class FDispersionProfiles
+    {
+    public:
+        static constexpr int32 NumSections = 16;
+
+        // Not real-time safe on the first request for a profile and sample rate; call when building operators.
+        static TSharedRef<const FAllPassSectionTable> Get(EDispersionProfile Profile, float SampleRate);
+    };
+}
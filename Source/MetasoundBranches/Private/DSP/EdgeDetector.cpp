@@ -0,0 +1,133 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Private/DSP/EdgeDetector.h"
+
+namespace MetasoundBranches
+{
+    namespace EdgeDetectorPrivate
+    {
+        // Upward from zero or below, or downward from zero or above
+        FORCEINLINE bool IsCrossing(float Previous, float Value)
+        {
+            return (Previous <= 0.0f && Value > 0.0f) || (Previous >= 0.0f && Value < 0.0f);
+        }
+
+        int32 FindCrossingScalar(const float* Signal, int32 StartFrame, int32 EndFrame, float PreviousValue)
+        {
+            for (int32 i = StartFrame; i < EndFrame; ++i)
+            {
+                if (IsCrossing(PreviousValue, Signal[i]))
+                {
+                    return i;
+                }
+                PreviousValue = Signal[i];
+            }
+            return EndFrame;
+        }
+
+        // Each step compares four samples with the four before them, read one frame back
+        int32 FindCrossingVector(const float* Signal, int32 StartFrame, int32 EndFrame, float PreviousValue)
+        {
+            if (StartFrame >= EndFrame || IsCrossing(PreviousValue, Signal[StartFrame]))
+            {
+                return StartFrame;
+            }
+
+            const VectorRegister4Float Zero = VectorSetFloat1(0.0f);
+
+            int32 i = StartFrame + 1;
+
+            for (; i + 4 <= EndFrame; i += 4)
+            {
+                const VectorRegister4Float Previous = VectorLoad(Signal + i - 1);
+                const VectorRegister4Float Value = VectorLoad(Signal + i);
+
+                const VectorRegister4Float Upward = VectorBitwiseAnd(VectorCompareGE(Zero, Previous), VectorCompareGT(Value, Zero));
+                const VectorRegister4Float Downward = VectorBitwiseAnd(VectorCompareGE(Previous, Zero), VectorCompareGT(Zero, Value));
+
+                if (const uint32 Mask = VectorMaskBits(VectorBitwiseOr(Upward, Downward)))
+                {
+                    return i + static_cast<int32>(FMath::CountTrailingZeros(Mask));
+                }
+            }
+
+            return FindCrossingScalar(Signal, i, EndFrame, Signal[i - 1]);
+        }
+
+#if METASOUNDBRANCHES_DSP_X86_DISPATCH
+        METASOUNDBRANCHES_DSP_TARGET_AVX2 int32 FindCrossingAVX2(const float* Signal, int32 StartFrame, int32 EndFrame, float PreviousValue)
+        {
+            if (StartFrame >= EndFrame || IsCrossing(PreviousValue, Signal[StartFrame]))
+            {
+                return StartFrame;
+            }
+
+            const __m256 Zero = _mm256_setzero_ps();
+
+            int32 i = StartFrame + 1;
+
+            for (; i + 8 <= EndFrame; i += 8)
+            {
+                const __m256 Previous = _mm256_loadu_ps(Signal + i - 1);
+                const __m256 Value = _mm256_loadu_ps(Signal + i);
+
+                const __m256 Upward = _mm256_and_ps(_mm256_cmp_ps(Previous, Zero, _CMP_LE_OQ), _mm256_cmp_ps(Value, Zero, _CMP_GT_OQ));
+                const __m256 Downward = _mm256_and_ps(_mm256_cmp_ps(Previous, Zero, _CMP_GE_OQ), _mm256_cmp_ps(Value, Zero, _CMP_LT_OQ));
+
+                if (const uint32 Mask = static_cast<uint32>(_mm256_movemask_ps(_mm256_or_ps(Upward, Downward))))
+                {
+                    return i + static_cast<int32>(FMath::CountTrailingZeros(Mask));
+                }
+            }
+
+            return FindCrossingScalar(Signal, i, EndFrame, Signal[i - 1]);
+        }
+
+        // The remainder runs as one masked step; masked-off lanes read as zero, which is never a crossing
+        METASOUNDBRANCHES_DSP_TARGET_AVX512 int32 FindCrossingAVX512(const float* Signal, int32 StartFrame, int32 EndFrame, float PreviousValue)
+        {
+            if (StartFrame >= EndFrame || IsCrossing(PreviousValue, Signal[StartFrame]))
+            {
+                return StartFrame;
+            }
+
+            const __m512 Zero = _mm512_setzero_ps();
+
+            for (int32 i = StartFrame + 1; i < EndFrame; i += 16)
+            {
+                const __mmask16 Lanes = (EndFrame - i >= 16) ? __mmask16(0xFFFF) : __mmask16((1u << (EndFrame - i)) - 1);
+
+                const __m512 Previous = _mm512_maskz_loadu_ps(Lanes, Signal + i - 1);
+                const __m512 Value = _mm512_maskz_loadu_ps(Lanes, Signal + i);
+
+                const __mmask16 Upward = _mm512_cmp_ps_mask(Previous, Zero, _CMP_LE_OQ) & _mm512_cmp_ps_mask(Value, Zero, _CMP_GT_OQ);
+                const __mmask16 Downward = _mm512_cmp_ps_mask(Previous, Zero, _CMP_GE_OQ) & _mm512_cmp_ps_mask(Value, Zero, _CMP_LT_OQ);
+
+                if (const uint32 Mask = static_cast<uint32>((Upward | Downward) & Lanes))
+                {
+                    return i + static_cast<int32>(FMath::CountTrailingZeros(Mask));
+                }
+            }
+
+            return EndFrame;
+        }
+#endif
+    }
+
+    FZeroCrossingDetector::FFindCrossingFunction FZeroCrossingDetector::GetFindCrossingFunction(ESimdLevel Level)
+    {
+        using namespace EdgeDetectorPrivate;
+
+#if METASOUNDBRANCHES_DSP_X86_DISPATCH
+        if (Level >= ESimdLevel::AVX512)
+        {
+            return &FindCrossingAVX512;
+        }
+        if (Level >= ESimdLevel::AVX2)
+        {
+            return &FindCrossingAVX2;
+        }
+#endif
+        return (Level == ESimdLevel::Scalar) ? &FindCrossingScalar : &FindCrossingVector;
+    }
+}
@@ -0,0 +1,197 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundBranches/Private/DSP/DSPCore.h"
+#include "MetasoundBranches/Private/DSP/SimdDispatch.h"
+
+namespace MetasoundBranches
+{
+    // Hold-off after a detection, in samples, recomputed only when the time changes
+    class FDebounce
+    {
+    public:
+        void Init(float InSampleRate)
+        {
+            SampleRate = InSampleRate;
+            LastTime = -1.0f;
+            Counter = 0;
+        }
+
+        // Debounce time in seconds, clamped to [1 ms, 5 s]
+        void SetTime(float Seconds)
+        {
+            if (Seconds != LastTime)
+            {
+                Samples = FMath::RoundToInt(FMath::Clamp(Seconds, 0.001f, 5.0f) * SampleRate);
+                LastTime = Seconds;
+            }
+        }
+
+        void Reset()
+        {
+            Counter = 0;
+        }
+
+        // Count down one sample; true if a detection is allowed on it
+        FORCEINLINE bool Tick()
+        {
+            if (Counter > 0)
+            {
+                --Counter;
+            }
+            return Counter <= 0;
+        }
+
+        FORCEINLINE void Restart()
+        {
+            Counter = Samples;
+        }
+
+        // Samples from now on that Tick() would still hold off
+        FORCEINLINE int32 GetHoldOff() const
+        {
+            return FMath::Max(Counter - 1, 0);
+        }
+
+        // Count down several samples at once, as that many Tick() calls would
+        FORCEINLINE void Advance(int32 NumSamples)
+        {
+            Counter = FMath::Max(Counter - NumSamples, 0);
+        }
+
+    private:
+        float SampleRate = 48000.0f;
+        float LastTime = -1.0f;
+        int32 Samples = 0;
+        int32 Counter = 0;
+    };
+
+    // Reports alternating rising and falling edges of a signal, with a debounce after each one
+    class FEdgeDetector
+    {
+    public:
+        void Init(float InSampleRate)
+        {
+            Debounce.Init(InSampleRate);
+            PreviousValue = 0.0f;
+            bPreviousIsRising = false;
+        }
+
+        void SetDebounceTime(float Seconds)
+        {
+            Debounce.SetTime(Seconds);
+        }
+
+        // Restart from a known previous sample, e.g. the first sample of the next block, to avoid a false edge
+        void Reset(float InPreviousValue)
+        {
+            PreviousValue = InPreviousValue;
+            Debounce.Reset();
+        }
+
+        // OnRise(Frame) and OnFall(Frame) are called in frame order
+        template<typename OnRiseType, typename OnFallType>
+        void Process(const float* Signal, int32 NumFrames, OnRiseType&& OnRise, OnFallType&& OnFall)
+        {
+            for (int32 i = 0; i < NumFrames; ++i)
+            {
+                const float Value = Signal[i];
+                const bool bCanTrigger = Debounce.Tick();
+
+                if (Value > PreviousValue && !bPreviousIsRising && bCanTrigger)
+                {
+                    OnRise(i);
+                    Debounce.Restart();
+                    bPreviousIsRising = true;
+                }
+                else if (Value < PreviousValue && bPreviousIsRising && bCanTrigger)
+                {
+                    OnFall(i);
+                    Debounce.Restart();
+                    bPreviousIsRising = false;
+                }
+
+                PreviousValue = Value;
+            }
+        }
+
+    private:
+        FDebounce Debounce;
+        float PreviousValue = 0.0f;
+        bool bPreviousIsRising = false;
+    };
+
+    // Reports sign changes of a signal (through or away from zero), with a debounce after each one.
+    //
+    // Rather than testing every sample, it skips the hold-off after each crossing and then scans for the next
+    // one with a SIMD search chosen at Init.
+    class FZeroCrossingDetector
+    {
+    public:
+        void Init(float InSampleRate, ESimdLevel InSimdLevel = ESimdLevel::Vector)
+        {
+            Debounce.Init(InSampleRate);
+            PreviousValue = 0.0f;
+            FindCrossing = GetFindCrossingFunction(InSimdLevel);
+        }
+
+        void SetDebounceTime(float Seconds)
+        {
+            Debounce.SetTime(Seconds);
+        }
+
+        void Reset(float InPreviousValue)
+        {
+            PreviousValue = InPreviousValue;
+            Debounce.Reset();
+        }
+
+        // OnCrossing(Frame) is called in frame order
+        template<typename OnCrossingType>
+        void Process(const float* Signal, int32 NumFrames, OnCrossingType&& OnCrossing)
+        {
+            int32 Frame = 0;
+
+            while (Frame < NumFrames)
+            {
+                const int32 HeldFrames = FMath::Min(Debounce.GetHoldOff(), NumFrames - Frame);
+                Debounce.Advance(HeldFrames);
+                Frame += HeldFrames;
+
+                if (Frame == NumFrames)
+                {
+                    break;
+                }
+
+                const int32 Crossing = FindCrossing(Signal, Frame, NumFrames, (Frame > 0) ? Signal[Frame - 1] : PreviousValue);
+
+                if (Crossing == NumFrames)
+                {
+                    Debounce.Advance(NumFrames - Frame);
+                    break;
+                }
+
+                OnCrossing(Crossing);
+                Debounce.Restart();
+                Frame = Crossing + 1;
+            }
+
+            if (NumFrames > 0)
+            {
+                PreviousValue = Signal[NumFrames - 1];
+            }
+        }
+
+        // First frame in [StartFrame, EndFrame) whose sign differs from the sample before it, or EndFrame.
+        // PreviousValue stands in for Signal[StartFrame - 1].
+        using FFindCrossingFunction = int32 (*)(const float* Signal, int32 StartFrame, int32 EndFrame, float PreviousValue);
+
+        static FFindCrossingFunction GetFindCrossingFunction(ESimdLevel Level);
+
+    private:
+        FDebounce Debounce;
+        float PreviousValue = 0.0f;
+        FFindCrossingFunction FindCrossing = GetFindCrossingFunction(ESimdLevel::Vector);
+    };
+}
@@ -0,0 +1,73 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundBranches/Private/DSP/DSPCore.h"
+#include "MetasoundBranches/Private/DSP/SimdDispatch.h"
+
+namespace MetasoundBranches
+{
+    namespace FastMath
+    {
+        // 2^X with a relative error below 1e-7 (about one float ulp) for X in [-126, 126]; inputs outside that
+        // range are clamped. Near X = 0 the slope is exact, so 1 - 2^X keeps its precision for tiny X.
+        // Branch-free, so loops calling it vectorise.
+        FORCEINLINE float Exp2(float X)
+        {
+            X = FMath::Clamp(X, -126.0f, 126.0f);
+
+            const float Whole = FMath::FloorToFloat(X + 0.5f);
+            const float Fraction = X - Whole;
+
+            // 2^f on [-0.5, 0.5]: ln(2) * f plus a degree-6 minimax fit of the rest
+            const float Mantissa = 1.0f + Fraction * (0.69314718f + Fraction * (0.24022648f + Fraction * (0.055503622f
+                + Fraction * (0.0096185263f + Fraction * (0.0013390161f + Fraction * 0.00015321154f)))));
+
+            // 2^n, built directly in the exponent field
+            const uint32 ExponentBits = static_cast<uint32>(static_cast<int32>(Whole) + 127) << 23;
+            float Scale;
+            FMemory::Memcpy(&Scale, &ExponentBits, sizeof(float));
+
+            return Mantissa * Scale;
+        }
+
+        // e^X. Rounding X * log2(e) adds error in proportion to |X|: relative error below 1.5e-7 * max(1, |X|) for
+        // X in [-87, 87].
+        FORCEINLINE float Exp(float X)
+        {
+            return Exp2(X * UE_INV_LN2);
+        }
+
+        // sin(pi/2 * X) for X in [0, 1], and so cos(pi/2 * X) as SinQuarterCycle(1 - X): the two gains of an
+        // equal-power pan or crossfade. Absolute error below 8.2e-7, and exactly 0 and 1 at the ends, so a hard
+        // pan or a completed crossfade passes the signal through unchanged. A degree-7 odd minimax fit, with
+        // overloads for each register width so per-sample gain laws stay in vector registers.
+        FORCEINLINE float SinQuarterCycle(float X)
+        {
+            const float Squared = X * X;
+            return X * (1.5707903f + Squared * (-0.64588606f + Squared * (0.079418354f + Squared * -0.0043225875f)));
+        }
+
+        FORCEINLINE VectorRegister4Float SinQuarterCycle(const VectorRegister4Float& X)
+        {
+            const VectorRegister4Float Squared = VectorMultiply(X, X);
+
+            VectorRegister4Float Result = VectorMultiplyAdd(Squared, VectorSetFloat1(-0.0043225875f), VectorSetFloat1(0.079418354f));
+            Result = VectorMultiplyAdd(Squared, Result, VectorSetFloat1(-0.64588606f));
+            Result = VectorMultiplyAdd(Squared, Result, VectorSetFloat1(1.5707903f));
+            return VectorMultiply(X, Result);
+        }
+
+#if METASOUNDBRANCHES_DSP_X86_DISPATCH
+        METASOUNDBRANCHES_DSP_TARGET_AVX2 FORCEINLINE __m256 SinQuarterCycle(__m256 X)
+        {
+            const __m256 Squared = _mm256_mul_ps(X, X);
+
+            __m256 Result = _mm256_fmadd_ps(Squared, _mm256_set1_ps(-0.0043225875f), _mm256_set1_ps(0.079418354f));
+            Result = _mm256_fmadd_ps(Squared, Result, _mm256_set1_ps(-0.64588606f));
+            Result = _mm256_fmadd_ps(Squared, Result, _mm256_set1_ps(1.5707903f));
+            return _mm256_mul_ps(X, Result);
+        }
+#endif
+    }
+}
@@ -0,0 +1,228 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundBranches/Private/DSP/DSPCore.h"
+#include "MetasoundBranches/Private/DSP/Silence.h"
+
+namespace MetasoundBranches
+{
+    // The FAllPassChain cascade for two or four channels at once, on an interleaved buffer.
+    //
+    // Stage state is interleaved per channel, so each SIMD lane holds one channel of one stage and a single
+    // vector operation advances the same stage(s) for every channel. Stereo packs two stages per vector,
+    // four channels one stage per vector; groups of stages are then pipelined as in the mono chain.
+    template<int32 NumChannels>
+    class TInterleavedAllPassChain
+    {
+        static_assert(NumChannels == 2 || NumChannels == 4, "Interleaved allpass chains support two or four channels.");
+
+    public:
+        void Init(int32 InMaxStages, float InCoefficient = 0.5f)
+        {
+            MaxStages = FMath::Max(InMaxStages, 0);
+            StateStride = Align(MaxStages * NumChannels, LanesPerVector);
+            Coefficient = InCoefficient;
+
+            State.SetNumZeroed(StateStride * 2);
+            bIsStateSilent = true;
+        }
+
+        void Reset()
+        {
+            FMemory::Memzero(State.GetData(), State.Num() * sizeof(float));
+            bIsStateSilent = true;
+        }
+
+        // Run the first NumStages stages over an interleaved buffer, in place. For stereo the buffer
+        // must be readable for one frame past NumFrames. Silence into a chain that has rung out is left as it is.
+        void ProcessInPlace(float* InOutInterleaved, int32 NumFrames, int32 NumStages)
+        {
+            NumStages = FMath::Clamp(NumStages, 0, MaxStages);
+
+            if (NumFrames <= 0 || (bIsStateSilent && IsSilent(InOutInterleaved, NumFrames * NumChannels)))
+            {
+                return;
+            }
+
+            FScopedDenormalGuard DenormalGuard;
+
+            int32 Stage = 0;
+
+            for (; Stage + StagesPerGroup<2>() <= NumStages; Stage += StagesPerGroup<2>())
+            {
+                ProcessGroup<2>(InOutInterleaved, NumFrames, Stage);
+            }
+
+            for (; Stage + StagesPerGroup<1>() <= NumStages; Stage += StagesPerGroup<1>())
+            {
+                ProcessGroup<1>(InOutInterleaved, NumFrames, Stage);
+            }
+
+            for (; Stage < NumStages; ++Stage)
+            {
+                for (int32 i = 0; i < NumFrames; ++i)
+                {
+                    for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+                    {
+                        float& Sample = InOutInterleaved[i * NumChannels + Channel];
+                        Sample = TickLane(Stage * NumChannels + Channel, Sample);
+                    }
+                }
+            }
+
+            FlushDenormals(State.GetData(), State.Num());
+            bIsStateSilent = IsSilent(State.GetData(), State.Num());
+        }
+
+    private:
+        static constexpr int32 LanesPerVector = 4;
+
+        template<int32 NumVectors>
+        static constexpr int32 StagesPerGroup()
+        {
+            return NumVectors * LanesPerVector / NumChannels;
+        }
+
+        template<int32 NumVectors>
+        void ProcessGroup(float* Buffer, int32 NumFrames, int32 FirstStage)
+        {
+            static constexpr int32 NumLanes = NumVectors * LanesPerVector;
+            static constexpr int32 LastSlot = StagesPerGroup<NumVectors>() - 1;
+
+            const int32 FirstLane = FirstStage * NumChannels;
+
+            // Most recent output of each stage slot, for every channel
+            alignas(16) float LaneOutputs[NumLanes] = {};
+
+            // Slot j processes frame (t - j) at step t; run lane by lane while the wavefront ramps in and out
+            auto PartialStep = [&](int32 Step)
+            {
+                for (int32 Slot = LastSlot; Slot >= 0; --Slot)
+                {
+                    const int32 Frame = Step - Slot;
+
+                    if (Frame >= 0 && Frame < NumFrames)
+                    {
+                        for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+                        {
+                            const int32 Lane = Slot * NumChannels + Channel;
+                            const float InSample = (Slot == 0) ? Buffer[Frame * NumChannels + Channel] : LaneOutputs[Lane - NumChannels];
+
+                            LaneOutputs[Lane] = TickLane(FirstLane + Lane, InSample);
+
+                            if (Slot == LastSlot)
+                            {
+                                Buffer[Frame * NumChannels + Channel] = LaneOutputs[Lane];
+                            }
+                        }
+                    }
+                }
+            };
+
+            const int32 NumSteps = NumFrames + LastSlot;
+            int32 Step = 0;
+
+            for (; Step < LastSlot; ++Step)
+            {
+                PartialStep(Step);
+            }
+
+            if (Step < NumFrames)
+            {
+                float* Delay0 = State.GetData() + FirstLane;
+                float* Delay1 = Delay0 + StateStride;
+
+                const VectorRegister4Float Coef = VectorSetFloat1(Coefficient);
+
+                VectorRegister4Float D0[NumVectors];
+                VectorRegister4Float D1[NumVectors];
+                VectorRegister4Float Out[NumVectors];
+
+                for (int32 v = 0; v < NumVectors; ++v)
+                {
+                    D0[v] = VectorLoadAligned(Delay0 + v * LanesPerVector);
+                    D1[v] = VectorLoadAligned(Delay1 + v * LanesPerVector);
+                    Out[v] = VectorLoadAligned(LaneOutputs + v * LanesPerVector);
+                }
+
+                for (; Step < NumFrames; ++Step)
+                {
+                    VectorRegister4Float In[NumVectors];
+                    const VectorRegister4Float Frame = VectorLoad(Buffer + Step * NumChannels);
+
+                    if constexpr (NumChannels == 4)
+                    {
+                        In[0] = Frame;
+                        for (int32 v = 1; v < NumVectors; ++v)
+                        {
+                            In[v] = Out[v - 1];
+                        }
+                    }
+                    else
+                    {
+                        // (L, R) of the new frame, then (L, R) of the previous slot
+                        In[0] = VectorShuffle(Frame, Out[0], 0, 1, 0, 1);
+                        for (int32 v = 1; v < NumVectors; ++v)
+                        {
+                            In[v] = VectorShuffle(Out[v - 1], Out[v], 2, 3, 0, 1);
+                        }
+                    }
+
+                    for (int32 v = 0; v < NumVectors; ++v)
+                    {
+                        Out[v] = VectorNegateMultiplyAdd(Coef, In[v], D0[v]);
+                        D0[v] = D1[v];
+                        D1[v] = VectorMultiplyAdd(Coef, Out[v], In[v]);
+                    }
+
+                    float* OutFrame = Buffer + (Step - LastSlot) * NumChannels;
+
+                    if constexpr (NumChannels == 4)
+                    {
+                        VectorStore(Out[NumVectors - 1], OutFrame);
+                    }
+                    else
+                    {
+                        OutFrame[0] = VectorGetComponent(Out[NumVectors - 1], 2);
+                        OutFrame[1] = VectorGetComponent(Out[NumVectors - 1], 3);
+                    }
+                }
+
+                for (int32 v = 0; v < NumVectors; ++v)
+                {
+                    VectorStoreAligned(D0[v], Delay0 + v * LanesPerVector);
+                    VectorStoreAligned(D1[v], Delay1 + v * LanesPerVector);
+                    VectorStoreAligned(Out[v], LaneOutputs + v * LanesPerVector);
+                }
+            }
+
+            for (; Step < NumSteps; ++Step)
+            {
+                PartialStep(Step);
+            }
+        }
+
+        // Advance one channel of one stage by a sample; Lane = Stage * NumChannels + Channel
+        FORCEINLINE float TickLane(int32 Lane, float InSample)
+        {
+            float* Delay0 = State.GetData();
+            float* Delay1 = Delay0 + StateStride;
+
+            const float OutSample = Delay0[Lane] - Coefficient * InSample;
+            Delay0[Lane] = Delay1[Lane];
+            Delay1[Lane] = InSample + Coefficient * OutSample;
+
+            return OutSample;
+        }
+
+        // Interleaved [stage][channel] state, laid out as in FAllPassChain
+        TArray<float, TAlignedHeapAllocator<16>> State;
+        int32 StateStride = 0;
+        int32 MaxStages = 0;
+        float Coefficient = 0.5f;
+
+        // Every lane's state is exactly zero
+        bool bIsStateSilent = true;
+    };
+}
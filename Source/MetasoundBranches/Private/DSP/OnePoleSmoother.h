@@ -0,0 +1,246 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundBranches/Private/DSP/DSPCore.h"
+#include "MetasoundBranches/Private/DSP/FastMath.h"
+
+namespace MetasoundBranches
+{
+    // Input policies: the target the smoother moves towards at each frame.
+
+    // A target per frame, e.g. an audio buffer
+    struct FSmootherBufferInput
+    {
+        const float* Data;
+
+        FORCEINLINE float operator()(int32 Frame) const { return Data[Frame]; }
+
+        // True if every target in the block equals Value
+        bool IsHeldAt(float Value, int32 NumFrames) const
+        {
+            for (int32 i = 0; i < NumFrames; ++i)
+            {
+                if (Data[i] != Value)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    // One target for the whole block, e.g. a float or bool input
+    struct FSmootherConstantInput
+    {
+        float Value;
+
+        FSmootherConstantInput(float InValue) : Value(InValue) {}
+        FSmootherConstantInput(bool bInValue) : Value(bInValue ? 1.0f : 0.0f) {}
+
+        FORCEINLINE float operator()(int32 /*Frame*/) const { return Value; }
+
+        bool IsHeldAt(float InValue, int32 /*NumFrames*/) const { return Value == InValue; }
+    };
+
+    // Coefficient policies: the rise and fall pole at each frame, alpha = exp(-1 / (time * rate)). An alpha
+    // of 0 jumps straight to the target; values towards 1 approach it more slowly.
+
+    // Times read once per block. The exponentials are only recomputed when a time changes.
+    class FSmootherBlockCoefficients
+    {
+    public:
+        explicit FSmootherBlockCoefficients(float InTicksPerSecond = 48000.0f)
+            : TicksPerSecond(InTicksPerSecond)
+        {
+        }
+
+        void Update(float RiseSeconds, float FallSeconds)
+        {
+            if (RiseSeconds != CachedRiseSeconds)
+            {
+                CachedRiseSeconds = RiseSeconds;
+                RiseAlpha = TimeToAlpha(RiseSeconds, TicksPerSecond);
+            }
+
+            if (FallSeconds != CachedFallSeconds)
+            {
+                CachedFallSeconds = FallSeconds;
+                FallAlpha = TimeToAlpha(FallSeconds, TicksPerSecond);
+            }
+        }
+
+        FORCEINLINE float GetRiseAlpha(int32 /*Frame*/) const { return RiseAlpha; }
+        FORCEINLINE float GetFallAlpha(int32 /*Frame*/) const { return FallAlpha; }
+
+        // Zero or negative times jump straight to the target
+        static float TimeToAlpha(float Seconds, float InTicksPerSecond)
+        {
+            return (Seconds > 0.0f) ? FMath::Exp(-1.0f / (Seconds * InTicksPerSecond)) : 0.0f;
+        }
+
+    private:
+        float TicksPerSecond;
+
+        float CachedRiseSeconds = 0.0f;
+        float CachedFallSeconds = 0.0f;
+        float RiseAlpha = 0.0f;
+        float FallAlpha = 0.0f;
+    };
+
+    // Times given per frame, e.g. audio-rate inputs. Alphas for a block are computed up front with
+    // FastMath::Exp2 into storage allocated at construction; a block with a constant time costs one FMath::Exp.
+    class FSmootherAudioRateCoefficients
+    {
+    public:
+        explicit FSmootherAudioRateCoefficients(float InTicksPerSecond = 48000.0f, int32 InMaxFrames = 0)
+            : TicksPerSecond(InTicksPerSecond)
+            , ExponentScale(-UE_INV_LN2 / InTicksPerSecond)
+        {
+            RiseAlphas.SetNumZeroed(InMaxFrames);
+            FallAlphas.SetNumZeroed(InMaxFrames);
+        }
+
+        void Update(const float* RiseSeconds, const float* FallSeconds, int32 NumFrames)
+        {
+            NumFrames = FMath::Min(NumFrames, RiseAlphas.Num());
+
+            TimesToAlphas(RiseSeconds, RiseAlphas.GetData(), NumFrames);
+            TimesToAlphas(FallSeconds, FallAlphas.GetData(), NumFrames);
+        }
+
+        FORCEINLINE float GetRiseAlpha(int32 Frame) const { return RiseAlphas.GetData()[Frame]; }
+        FORCEINLINE float GetFallAlpha(int32 Frame) const { return FallAlphas.GetData()[Frame]; }
+
+    private:
+        void TimesToAlphas(const float* Seconds, float* OutAlphas, int32 NumFrames) const
+        {
+            bool bIsConstant = true;
+
+            for (int32 i = 1; i < NumFrames && bIsConstant; ++i)
+            {
+                bIsConstant = (Seconds[i] == Seconds[0]);
+            }
+
+            if (bIsConstant)
+            {
+                if (NumFrames > 0)
+                {
+                    const float Alpha = FSmootherBlockCoefficients::TimeToAlpha(Seconds[0], TicksPerSecond);
+                    Audio::ArraySetToConstantInplace(TArrayView<float>(OutAlphas, NumFrames), Alpha);
+                }
+                return;
+            }
+
+            // exp(-1 / (t * rate)) = 2^(-log2(e) / (t * rate)); the clamp keeps zero times finite before the select
+            for (int32 i = 0; i < NumFrames; ++i)
+            {
+                const float Alpha = FastMath::Exp2(ExponentScale / FMath::Max(Seconds[i], UE_SMALL_NUMBER));
+                OutAlphas[i] = (Seconds[i] > 0.0f) ? Alpha : 0.0f;
+            }
+        }
+
+        float TicksPerSecond;
+        float ExponentScale;
+
+        TArray<float, TAlignedHeapAllocator<16>> RiseAlphas;
+        TArray<float, TAlignedHeapAllocator<16>> FallAlphas;
+    };
+
+    // Asymmetric one-pole smoother: rises and falls towards the target with separate time constants.
+    //
+    // The input and coefficient sources are template policies, so each node gets its own inner loop with the
+    // per-frame reads inlined and, for block-rate sources, hoisted out of the loop. The rise/fall choice is a
+    // select rather than a branch.
+    //
+    // The state is the output's distance from the target rather than the output itself. Holding the output
+    // directly, a long time constant stalls short of the target once each step is below float resolution; the
+    // distance keeps its precision as it decays, so the output always arrives. Once the distance is within
+    // SettledThreshold, or too small to change the output, it is zeroed; while the target stays there the
+    // recursion is skipped and the block is a constant fill.
+    template<typename CoefficientPolicy>
+    class TOnePoleSmoother
+    {
+    public:
+        explicit TOnePoleSmoother(const CoefficientPolicy& InCoefficients = CoefficientPolicy())
+            : Coefficients(InCoefficients)
+        {
+        }
+
+        CoefficientPolicy& GetCoefficients() { return Coefficients; }
+
+        float GetValue() const { return Target + Distance; }
+
+        void Reset(float InValue = 0.0f)
+        {
+            Target = InValue;
+            Distance = 0.0f;
+        }
+
+        // Largest distance from the target treated as having arrived (-120 dB)
+        static constexpr float SettledThreshold = 1.0e-6f;
+
+        template<typename InputPolicy>
+        void Process(const InputPolicy& Input, float* OutBuffer, int32 NumFrames)
+        {
+            if (NumFrames <= 0)
+            {
+                return;
+            }
+
+            // Settled output and an unchanged target: every alpha leaves the output where it is
+            if (Distance == 0.0f && Input.IsHeldAt(Target, NumFrames))
+            {
+                Audio::ArraySetToConstantInplace(TArrayView<float>(OutBuffer, NumFrames), Target);
+                return;
+            }
+
+            // Approaching a zero target passes through the subnormal range before Settle() can snap
+            FScopedDenormalGuard DenormalGuard;
+
+            float CurrentTarget = Target;
+            float CurrentDistance = Distance;
+
+            for (int32 i = 0; i < NumFrames; ++i)
+            {
+                const float NextTarget = Input(i);
+                CurrentDistance = Tick(CurrentDistance + (CurrentTarget - NextTarget), i);
+                CurrentTarget = NextTarget;
+                OutBuffer[i] = CurrentTarget + CurrentDistance;
+            }
+
+            Target = CurrentTarget;
+            Distance = Settle(CurrentDistance, CurrentTarget);
+        }
+
+        // Advance by a single frame, for control-rate smoothing
+        float ProcessFrame(float NextTarget)
+        {
+            Distance = Settle(Tick(Distance + (Target - NextTarget), 0), NextTarget);
+            Target = NextTarget;
+            return Target + Distance;
+        }
+
+    private:
+        // Snap to the target once close enough, or once the output already equals it, rather than creeping
+        // towards it through denormals
+        static FORCEINLINE float Settle(float InDistance, float InTarget)
+        {
+            return (FMath::Abs(InDistance) <= SettledThreshold || InTarget + InDistance == InTarget) ? 0.0f : InDistance;
+        }
+
+        // Takes and returns the output's distance from the target. A negative distance is below the target, so
+        // rising. alpha * d gives exactly the target for a zero time or a settled output.
+        FORCEINLINE float Tick(float InDistance, int32 Frame) const
+        {
+            const float Alpha = (InDistance < 0.0f) ? Coefficients.GetRiseAlpha(Frame) : Coefficients.GetFallAlpha(Frame);
+            return Alpha * InDistance;
+        }
+
+        CoefficientPolicy Coefficients;
+
+        // Target of the last frame processed, and the output's distance from it
+        float Target = 0.0f;
+        float Distance = 0.0f;
+    };
+}
@@ -0,0 +1,151 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundBranches/Private/DSP/DSPCore.h"
+#include "MetasoundBranches/Private/DSP/CounterRandom.h"
+
+namespace MetasoundBranches
+{
+    // Schedules the events of a Poisson process with a rate given in Hz.
+    //
+    // Rather than testing a random number every sample, the scheduler draws the exponentially distributed
+    // amount of "rate mass" until the next event and spends it as time passes. With a constant rate the
+    // gap is a single division, so a block costs one random draw per event; with audio-rate modulation the
+    // rate is integrated sample by sample, still drawing only once per event. Intervals come from a
+    // seeded FCounterRandom, generated a block at a time.
+    class FPoissonScheduler
+    {
+    public:
+        void Init(float InSampleRate, uint32 InSeed)
+        {
+            SampleRate = FMath::Max(InSampleRate, 1.0f);
+            SetSeed(InSeed);
+        }
+
+        // Restart the random sequence; the same seed and inputs always give the same events
+        void SetSeed(uint32 InSeed)
+        {
+            Random.SetSeed(InSeed);
+            NextInterval = NumPooledIntervals;
+            Remaining = DrawInterval();
+        }
+
+        // Run one block. Rate at frame i is (RateHz + |Modulation[i]|); Modulation may be null.
+        // OnEvent(Frame) is called at most once per frame, in order.
+        template<typename OnEventType>
+        void Process(const float* Modulation, float RateHz, int32 NumFrames, OnEventType&& OnEvent)
+        {
+            if (Modulation == nullptr || IsConstant(Modulation, NumFrames))
+            {
+                const float Offset = (Modulation && NumFrames > 0) ? FMath::Abs(Modulation[0]) : 0.0f;
+                ProcessConstant(RateHz + Offset, NumFrames, OnEvent);
+            }
+            else
+            {
+                ProcessModulated(Modulation, RateHz, NumFrames, OnEvent);
+            }
+        }
+
+    private:
+        template<typename OnEventType>
+        void ProcessConstant(float RateHz, int32 NumFrames, OnEventType& OnEvent)
+        {
+            const float RatePerSample = FMath::Clamp(RateHz, 0.0f, SampleRate) / SampleRate;
+
+            if (RatePerSample <= 0.0f)
+            {
+                return;
+            }
+
+            // Position, in samples from the start of the block, of the next event
+            float Position = Remaining / RatePerSample;
+            int32 LastFrame = -1;
+
+            while (Position < NumFrames)
+            {
+                const int32 Frame = FMath::FloorToInt(Position);
+
+                if (Frame > LastFrame)
+                {
+                    OnEvent(Frame);
+                    LastFrame = Frame;
+                }
+
+                Position += DrawInterval() / RatePerSample;
+            }
+
+            Remaining = (Position - NumFrames) * RatePerSample;
+        }
+
+        template<typename OnEventType>
+        void ProcessModulated(const float* Modulation, float RateHz, int32 NumFrames, OnEventType& OnEvent)
+        {
+            const float InvSampleRate = 1.0f / SampleRate;
+
+            for (int32 i = 0; i < NumFrames; ++i)
+            {
+                const float RatePerSample = FMath::Clamp(RateHz + FMath::Abs(Modulation[i]), 0.0f, SampleRate) * InvSampleRate;
+
+                Remaining -= RatePerSample;
+
+                if (Remaining <= 0.0f)
+                {
+                    OnEvent(i);
+
+                    // Carry the overshoot, and drop any further events that would land in this frame
+                    do
+                    {
+                        Remaining += DrawInterval();
+                    }
+                    while (Remaining <= 0.0f);
+                }
+            }
+        }
+
+        static bool IsConstant(const float* Data, int32 NumFrames)
+        {
+            for (int32 i = 1; i < NumFrames; ++i)
+            {
+                if (Data[i] != Data[0])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Exponentially distributed with unit mean
+        float DrawInterval()
+        {
+            if (NextInterval == NumPooledIntervals)
+            {
+                RefillIntervals();
+            }
+            return Intervals[NextInterval++];
+        }
+
+        // Uniforms are generated a block at a time, then mapped to intervals
+        void RefillIntervals()
+        {
+            Random.GenerateFractions(Intervals, NumPooledIntervals);
+
+            for (int32 i = 0; i < NumPooledIntervals; ++i)
+            {
+                Intervals[i] = -FMath::Loge(1.0f - Intervals[i]);
+            }
+
+            NextInterval = 0;
+        }
+
+        static constexpr int32 NumPooledIntervals = 64;
+
+        FCounterRandom Random;
+        alignas(16) float Intervals[NumPooledIntervals];
+        int32 NextInterval = NumPooledIntervals;
+        float SampleRate = 48000.0f;
+
+        // Rate mass (expected events) still to elapse before the next event
+        float Remaining = 1.0f;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Private/DSP/Silence.h"
+
+namespace MetasoundBranches
+{
+    bool IsSilent(const float* InData, int32 NumSamples)
+    {
+        static constexpr int32 ChunkSize = 16;
+
+        const VectorRegister4Float Zero = VectorSetFloat1(0.0f);
+
+        int32 i = 0;
+
+        for (; i + ChunkSize <= NumSamples; i += ChunkSize)
+        {
+            const VectorRegister4Float Peak = VectorMax(
+                VectorMax(VectorAbs(VectorLoad(InData + i)), VectorAbs(VectorLoad(InData + i + 4))),
+                VectorMax(VectorAbs(VectorLoad(InData + i + 8)), VectorAbs(VectorLoad(InData + i + 12))));
+
+            if (VectorAnyGreaterThan(Peak, Zero))
+            {
+                return false;
+            }
+        }
+
+        for (; i < NumSamples; ++i)
+        {
+            if (InData[i] != 0.0f)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
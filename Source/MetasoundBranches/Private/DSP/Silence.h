@@ -0,0 +1,56 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundBranches/Private/DSP/DSPCore.h"
+#include <initializer_list>
+
+namespace MetasoundBranches
+{
+    // True if every sample is zero, of either sign. NaNs may be missed, which at worst silences a broken block.
+    //
+    // The block is scanned a few vectors at a time and the scan stops at the first chunk holding a non-zero
+    // sample, so on a block with content it usually reads only the first 16 samples; the full cost is only
+    // paid on blocks that are silent, where it saves the processing it precedes.
+    bool IsSilent(const float* InData, int32 NumSamples);
+
+    // Short-circuit for stateless nodes, whose output is zero whenever all of their audio inputs are. The first
+    // silent block fills the outputs with zeros; later ones find them still zeroed and skip the fill as well, so
+    // a silent send costs only the input scans.
+    class FSilenceGate
+    {
+    public:
+        // True if the inputs are silent and the outputs now hold zeros; otherwise the caller processes the block
+        bool SkipBlock(std::initializer_list<const float*> Inputs, std::initializer_list<float*> Outputs, int32 NumFrames)
+        {
+            for (const float* Input : Inputs)
+            {
+                if (!IsSilent(Input, NumFrames))
+                {
+                    bOutputsAreZero = false;
+                    return false;
+                }
+            }
+
+            if (!bOutputsAreZero)
+            {
+                for (float* Output : Outputs)
+                {
+                    FMemory::Memzero(Output, NumFrames * sizeof(float));
+                }
+                bOutputsAreZero = true;
+            }
+
+            return true;
+        }
+
+        // Call whenever the outputs are written outside SkipBlock
+        void Reset()
+        {
+            bOutputsAreZero = false;
+        }
+
+    private:
+        bool bOutputsAreZero = false;
+    };
+}
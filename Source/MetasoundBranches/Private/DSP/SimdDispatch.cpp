@@ -0,0 +1,110 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Private/DSP/SimdDispatch.h"
+
+#if METASOUNDBRANCHES_DSP_X86_DISPATCH
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace MetasoundBranches
+{
+    namespace SimdDispatchPrivate
+    {
+#if METASOUNDBRANCHES_DSP_X86_DISPATCH
+        // EAX, EBX, ECX, EDX of the given CPUID leaf
+        void CpuId(uint32 Leaf, uint32 SubLeaf, uint32 OutRegisters[4])
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            int Registers[4];
+            __cpuidex(Registers, static_cast<int>(Leaf), static_cast<int>(SubLeaf));
+            for (int32 i = 0; i < 4; ++i)
+            {
+                OutRegisters[i] = static_cast<uint32>(Registers[i]);
+            }
+#else
+            __cpuid_count(Leaf, SubLeaf, OutRegisters[0], OutRegisters[1], OutRegisters[2], OutRegisters[3]);
+#endif
+        }
+
+        // The register state the OS saves on a context switch (XCR0)
+        uint64 GetEnabledStateComponents()
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return _xgetbv(0);
+#else
+            uint32 Low;
+            uint32 High;
+            __asm__ __volatile__("xgetbv" : "=a"(Low), "=d"(High) : "c"(0));
+            return (static_cast<uint64>(High) << 32) | Low;
+#endif
+        }
+
+        ESimdLevel DetectSimdLevel()
+        {
+            uint32 Registers[4];
+
+            CpuId(0, 0, Registers);
+            if (Registers[0] < 7)
+            {
+                return ESimdLevel::Vector;
+            }
+
+            // FMA3, OSXSAVE and AVX
+            CpuId(1, 0, Registers);
+            const bool bHasFMA = (Registers[2] & (1u << 12)) != 0;
+            const bool bHasOSXSave = (Registers[2] & (1u << 27)) != 0;
+            const bool bHasAVX = (Registers[2] & (1u << 28)) != 0;
+
+            if (!bHasFMA || !bHasOSXSave || !bHasAVX)
+            {
+                return ESimdLevel::Vector;
+            }
+
+            // The OS must save the YMM registers, and for AVX-512 the opmask and ZMM registers too
+            const uint64 StateComponents = GetEnabledStateComponents();
+            if ((StateComponents & 0x06) != 0x06)
+            {
+                return ESimdLevel::Vector;
+            }
+
+            CpuId(7, 0, Registers);
+            const bool bHasAVX2 = (Registers[1] & (1u << 5)) != 0;
+            const bool bHasAVX512F = (Registers[1] & (1u << 16)) != 0;
+
+            if (!bHasAVX2)
+            {
+                return ESimdLevel::Vector;
+            }
+
+            return (bHasAVX512F && (StateComponents & 0xE6) == 0xE6) ? ESimdLevel::AVX512 : ESimdLevel::AVX2;
+        }
+#else
+        ESimdLevel DetectSimdLevel()
+        {
+            return ESimdLevel::Vector;
+        }
+#endif
+    }
+
+    ESimdLevel GetHostSimdLevel()
+    {
+        static const ESimdLevel HostLevel = SimdDispatchPrivate::DetectSimdLevel();
+        return HostLevel;
+    }
+
+    const char* GetSimdLevelName(ESimdLevel Level)
+    {
+        switch (Level)
+        {
+            case ESimdLevel::Scalar: return "Scalar";
+            case ESimdLevel::Vector: return "Vector";
+            case ESimdLevel::AVX2: return "AVX2";
+            case ESimdLevel::AVX512: return "AVX-512";
+            default: return "Unknown";
+        }
+    }
+}
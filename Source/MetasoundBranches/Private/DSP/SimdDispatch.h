@@ -0,0 +1,49 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundBranches/Private/DSP/DSPCore.h"
+
+// Kernels built for instruction sets above the engine's baseline, selected at run time. Only x86-64 has them:
+// each such function is compiled for its instruction set with a target attribute (MSVC needs none), and is
+// only called once the CPU and OS have been found to support it. ARM64 stays on the NEON baseline.
+#if defined(_M_X64) || defined(__x86_64__)
+#define METASOUNDBRANCHES_DSP_X86_DISPATCH 1
+#include <immintrin.h>
+#if defined(__clang__) || defined(__GNUC__)
+#define METASOUNDBRANCHES_DSP_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define METASOUNDBRANCHES_DSP_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+#else
+#define METASOUNDBRANCHES_DSP_TARGET_AVX2
+#define METASOUNDBRANCHES_DSP_TARGET_AVX512
+#endif
+#else
+#define METASOUNDBRANCHES_DSP_X86_DISPATCH 0
+#endif
+
+namespace MetasoundBranches
+{
+    // Kernel implementations, in increasing order of width. Each level falls back to the widest one below it
+    // that a kernel provides.
+    enum class ESimdLevel : uint8
+    {
+        // Plain C++, one sample at a time: the reference the others are checked against
+        Scalar,
+
+        // Four lanes through VectorRegister (SSE or NEON): what every supported CPU runs
+        Vector,
+
+        // Eight lanes with fused multiply-add (x86-64 with AVX2 and FMA3)
+        AVX2,
+
+        // Sixteen lanes (x86-64 with AVX-512F)
+        AVX512,
+
+        Num
+    };
+
+    // The widest level this CPU and OS support, detected on first call
+    ESimdLevel GetHostSimdLevel();
+
+    const char* GetSimdLevelName(ESimdLevel Level);
+}
@@ -0,0 +1,712 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Private/DSP/StereoMatrix.h"
+
+namespace MetasoundBranches
+{
+    namespace StereoMatrixPrivate
+    {
+        // One output channel: Direct * Same + Cross * Other, with the terms the shape leaves out never computed.
+        // A crossfade is the same sum with the two pairs' gains as Direct and Cross.
+        template<bool bDirect, bool bCross>
+        FORCEINLINE float Mix(float Direct, float Same, float Cross, float Other)
+        {
+            if constexpr (bDirect && bCross)
+            {
+                return Direct * Same + Cross * Other;
+            }
+            else if constexpr (bDirect)
+            {
+                return Direct * Same;
+            }
+            else
+            {
+                return Cross * Other;
+            }
+        }
+
+        template<bool bDirect, bool bCross>
+        FORCEINLINE VectorRegister4Float Mix(const VectorRegister4Float& Direct, const VectorRegister4Float& Same,
+            const VectorRegister4Float& Cross, const VectorRegister4Float& Other)
+        {
+            if constexpr (bDirect && bCross)
+            {
+                return VectorMultiplyAdd(Cross, Other, VectorMultiply(Direct, Same));
+            }
+            else if constexpr (bDirect)
+            {
+                return VectorMultiply(Direct, Same);
+            }
+            else
+            {
+                return VectorMultiply(Cross, Other);
+            }
+        }
+
+        // The per-shape loops for one instruction set, as TKernel<bDirect, bCross>::Process. The zero shape
+        // needs no loop.
+        template<bool bDirect, bool bCross>
+        struct TMatrixScalar
+        {
+            static void Process(const FStereoMatrix& Matrix, const float* InLeft, const float* InRight,
+                float* OutLeft, float* OutRight, int32 NumFrames)
+            {
+                for (int32 i = 0; i < NumFrames; ++i)
+                {
+                    const float Left = InLeft[i];
+                    const float Right = InRight[i];
+
+                    OutLeft[i] = Mix<bDirect, bCross>(Matrix.LeftToLeft, Left, Matrix.RightToLeft, Right);
+                    OutRight[i] = Mix<bDirect, bCross>(Matrix.RightToRight, Right, Matrix.LeftToRight, Left);
+                }
+            }
+        };
+
+        template<bool bDirect, bool bCross>
+        struct TMatrixVector
+        {
+            static void Process(const FStereoMatrix& Matrix, const float* InLeft, const float* InRight,
+                float* OutLeft, float* OutRight, int32 NumFrames)
+            {
+                const VectorRegister4Float LL = VectorSetFloat1(Matrix.LeftToLeft);
+                const VectorRegister4Float RL = VectorSetFloat1(Matrix.RightToLeft);
+                const VectorRegister4Float LR = VectorSetFloat1(Matrix.LeftToRight);
+                const VectorRegister4Float RR = VectorSetFloat1(Matrix.RightToRight);
+
+                int32 i = 0;
+
+                for (; i + 4 <= NumFrames; i += 4)
+                {
+                    const VectorRegister4Float Left = VectorLoad(InLeft + i);
+                    const VectorRegister4Float Right = VectorLoad(InRight + i);
+
+                    VectorStore(Mix<bDirect, bCross>(LL, Left, RL, Right), OutLeft + i);
+                    VectorStore(Mix<bDirect, bCross>(RR, Right, LR, Left), OutRight + i);
+                }
+
+                TMatrixScalar<bDirect, bCross>::Process(Matrix, InLeft + i, InRight + i, OutLeft + i, OutRight + i, NumFrames - i);
+            }
+        };
+
+        template<bool bA, bool bB>
+        struct TCrossfadeScalar
+        {
+            static void Process(const FStereoCrossfade& Crossfade, const float* InLeftA, const float* InRightA,
+                const float* InLeftB, const float* InRightB, float* OutLeft, float* OutRight, int32 NumFrames)
+            {
+                for (int32 i = 0; i < NumFrames; ++i)
+                {
+                    OutLeft[i] = Mix<bA, bB>(Crossfade.GainA, InLeftA[i], Crossfade.GainB, InLeftB[i]);
+                    OutRight[i] = Mix<bA, bB>(Crossfade.GainA, InRightA[i], Crossfade.GainB, InRightB[i]);
+                }
+            }
+        };
+
+        template<bool bA, bool bB>
+        struct TCrossfadeVector
+        {
+            static void Process(const FStereoCrossfade& Crossfade, const float* InLeftA, const float* InRightA,
+                const float* InLeftB, const float* InRightB, float* OutLeft, float* OutRight, int32 NumFrames)
+            {
+                const VectorRegister4Float A = VectorSetFloat1(Crossfade.GainA);
+                const VectorRegister4Float B = VectorSetFloat1(Crossfade.GainB);
+
+                int32 i = 0;
+
+                // Inputs the shape leaves out are never read
+                for (; i + 4 <= NumFrames; i += 4)
+                {
+                    const VectorRegister4Float LeftA = bA ? VectorLoad(InLeftA + i) : A;
+                    const VectorRegister4Float RightA = bA ? VectorLoad(InRightA + i) : A;
+                    const VectorRegister4Float LeftB = bB ? VectorLoad(InLeftB + i) : B;
+                    const VectorRegister4Float RightB = bB ? VectorLoad(InRightB + i) : B;
+
+                    VectorStore(Mix<bA, bB>(A, LeftA, B, LeftB), OutLeft + i);
+                    VectorStore(Mix<bA, bB>(A, RightA, B, RightB), OutRight + i);
+                }
+
+                TCrossfadeScalar<bA, bB>::Process(Crossfade, InLeftA + i, InRightA + i, InLeftB + i, InRightB + i, OutLeft + i, OutRight + i, NumFrames - i);
+            }
+        };
+
+        // Ramp loops, one per shape as above. Frame i (counted from the start of the block) uses From + Step * (i + 1);
+        // the frame number is carried as a float, exact for any block size, so no error builds up along the
+        // block. StartFrame lets the wider loops hand their remainder to the scalar one.
+        template<bool bDirect, bool bCross>
+        struct TMatrixRampScalar
+        {
+            static void Process(const FStereoMatrix& From, const FStereoMatrix& Step, const float* InLeft, const float* InRight,
+                float* OutLeft, float* OutRight, int32 StartFrame, int32 NumFrames)
+            {
+                for (int32 i = StartFrame; i < NumFrames; ++i)
+                {
+                    const float Frame = static_cast<float>(i + 1);
+                    const float Left = InLeft[i];
+                    const float Right = InRight[i];
+
+                    OutLeft[i] = Mix<bDirect, bCross>(From.LeftToLeft + Step.LeftToLeft * Frame, Left, From.RightToLeft + Step.RightToLeft * Frame, Right);
+                    OutRight[i] = Mix<bDirect, bCross>(From.RightToRight + Step.RightToRight * Frame, Right, From.LeftToRight + Step.LeftToRight * Frame, Left);
+                }
+            }
+        };
+
+        template<bool bDirect, bool bCross>
+        struct TMatrixRampVector
+        {
+            static void Process(const FStereoMatrix& From, const FStereoMatrix& Step, const float* InLeft, const float* InRight,
+                float* OutLeft, float* OutRight, int32 StartFrame, int32 NumFrames)
+            {
+                const VectorRegister4Float LL = VectorSetFloat1(From.LeftToLeft);
+                const VectorRegister4Float RL = VectorSetFloat1(From.RightToLeft);
+                const VectorRegister4Float LR = VectorSetFloat1(From.LeftToRight);
+                const VectorRegister4Float RR = VectorSetFloat1(From.RightToRight);
+
+                const VectorRegister4Float StepLL = VectorSetFloat1(Step.LeftToLeft);
+                const VectorRegister4Float StepRL = VectorSetFloat1(Step.RightToLeft);
+                const VectorRegister4Float StepLR = VectorSetFloat1(Step.LeftToRight);
+                const VectorRegister4Float StepRR = VectorSetFloat1(Step.RightToRight);
+
+                const VectorRegister4Float Four = VectorSetFloat1(4.0f);
+                VectorRegister4Float Frame = VectorAdd(VectorIntToFloat(MakeVectorRegisterInt(1, 2, 3, 4)), VectorSetFloat1(static_cast<float>(StartFrame)));
+
+                int32 i = StartFrame;
+
+                for (; i + 4 <= NumFrames; i += 4)
+                {
+                    const VectorRegister4Float Left = VectorLoad(InLeft + i);
+                    const VectorRegister4Float Right = VectorLoad(InRight + i);
+
+                    VectorStore(Mix<bDirect, bCross>(VectorMultiplyAdd(StepLL, Frame, LL), Left, VectorMultiplyAdd(StepRL, Frame, RL), Right), OutLeft + i);
+                    VectorStore(Mix<bDirect, bCross>(VectorMultiplyAdd(StepRR, Frame, RR), Right, VectorMultiplyAdd(StepLR, Frame, LR), Left), OutRight + i);
+
+                    Frame = VectorAdd(Frame, Four);
+                }
+
+                TMatrixRampScalar<bDirect, bCross>::Process(From, Step, InLeft, InRight, OutLeft, OutRight, i, NumFrames);
+            }
+        };
+
+        template<bool bA, bool bB>
+        struct TCrossfadeRampScalar
+        {
+            static void Process(const FStereoCrossfade& From, const FStereoCrossfade& Step, const float* InLeftA, const float* InRightA,
+                const float* InLeftB, const float* InRightB, float* OutLeft, float* OutRight, int32 StartFrame, int32 NumFrames)
+            {
+                for (int32 i = StartFrame; i < NumFrames; ++i)
+                {
+                    const float Frame = static_cast<float>(i + 1);
+                    const float A = From.GainA + Step.GainA * Frame;
+                    const float B = From.GainB + Step.GainB * Frame;
+
+                    OutLeft[i] = Mix<bA, bB>(A, InLeftA[i], B, InLeftB[i]);
+                    OutRight[i] = Mix<bA, bB>(A, InRightA[i], B, InRightB[i]);
+                }
+            }
+        };
+
+        template<bool bA, bool bB>
+        struct TCrossfadeRampVector
+        {
+            static void Process(const FStereoCrossfade& From, const FStereoCrossfade& Step, const float* InLeftA, const float* InRightA,
+                const float* InLeftB, const float* InRightB, float* OutLeft, float* OutRight, int32 StartFrame, int32 NumFrames)
+            {
+                const VectorRegister4Float FromA = VectorSetFloat1(From.GainA);
+                const VectorRegister4Float FromB = VectorSetFloat1(From.GainB);
+                const VectorRegister4Float StepA = VectorSetFloat1(Step.GainA);
+                const VectorRegister4Float StepB = VectorSetFloat1(Step.GainB);
+
+                const VectorRegister4Float Four = VectorSetFloat1(4.0f);
+                VectorRegister4Float Frame = VectorAdd(VectorIntToFloat(MakeVectorRegisterInt(1, 2, 3, 4)), VectorSetFloat1(static_cast<float>(StartFrame)));
+
+                int32 i = StartFrame;
+
+                for (; i + 4 <= NumFrames; i += 4)
+                {
+                    const VectorRegister4Float A = VectorMultiplyAdd(StepA, Frame, FromA);
+                    const VectorRegister4Float B = VectorMultiplyAdd(StepB, Frame, FromB);
+
+                    const VectorRegister4Float LeftA = bA ? VectorLoad(InLeftA + i) : A;
+                    const VectorRegister4Float RightA = bA ? VectorLoad(InRightA + i) : A;
+                    const VectorRegister4Float LeftB = bB ? VectorLoad(InLeftB + i) : B;
+                    const VectorRegister4Float RightB = bB ? VectorLoad(InRightB + i) : B;
+
+                    VectorStore(Mix<bA, bB>(A, LeftA, B, LeftB), OutLeft + i);
+                    VectorStore(Mix<bA, bB>(A, RightA, B, RightB), OutRight + i);
+
+                    Frame = VectorAdd(Frame, Four);
+                }
+
+                TCrossfadeRampScalar<bA, bB>::Process(From, Step, InLeftA, InRightA, InLeftB, InRightB, OutLeft, OutRight, i, NumFrames);
+            }
+        };
+
+        // Branches on the shape once per call, then runs that shape's loop
+        template<template<bool, bool> class TKernel>
+        void ProcessMatrixShaped(const FStereoMatrix& Matrix, const float* InLeft, const float* InRight,
+            float* OutLeft, float* OutRight, int32 NumFrames)
+        {
+            switch (Matrix.GetShape())
+            {
+            case EStereoMatrixShape::Zero:
+                FMemory::Memzero(OutLeft, NumFrames * sizeof(float));
+                FMemory::Memzero(OutRight, NumFrames * sizeof(float));
+                break;
+
+            case EStereoMatrixShape::Direct:
+                TKernel<true, false>::Process(Matrix, InLeft, InRight, OutLeft, OutRight, NumFrames);
+                break;
+
+            case EStereoMatrixShape::Cross:
+                TKernel<false, true>::Process(Matrix, InLeft, InRight, OutLeft, OutRight, NumFrames);
+                break;
+
+            default:
+                TKernel<true, true>::Process(Matrix, InLeft, InRight, OutLeft, OutRight, NumFrames);
+                break;
+            }
+        }
+
+        template<template<bool, bool> class TKernel>
+        void ProcessCrossfadeShaped(const FStereoCrossfade& Crossfade, const float* InLeftA, const float* InRightA,
+            const float* InLeftB, const float* InRightB, float* OutLeft, float* OutRight, int32 NumFrames)
+        {
+            switch (Crossfade.GetShape())
+            {
+            case EStereoMatrixShape::Zero:
+                FMemory::Memzero(OutLeft, NumFrames * sizeof(float));
+                FMemory::Memzero(OutRight, NumFrames * sizeof(float));
+                break;
+
+            case EStereoMatrixShape::Direct:
+                TKernel<true, false>::Process(Crossfade, InLeftA, InRightA, InLeftB, InRightB, OutLeft, OutRight, NumFrames);
+                break;
+
+            case EStereoMatrixShape::Cross:
+                TKernel<false, true>::Process(Crossfade, InLeftA, InRightA, InLeftB, InRightB, OutLeft, OutRight, NumFrames);
+                break;
+
+            default:
+                TKernel<true, true>::Process(Crossfade, InLeftA, InRightA, InLeftB, InRightB, OutLeft, OutRight, NumFrames);
+                break;
+            }
+        }
+
+        // The shape of a ramp is that of both ends together: a term that is non-zero at either end is needed
+        // throughout
+        FORCEINLINE EStereoMatrixShape GetRampShape(EStereoMatrixShape From, EStereoMatrixShape To)
+        {
+            return static_cast<EStereoMatrixShape>(static_cast<uint8>(From) | static_cast<uint8>(To));
+        }
+
+        template<template<bool, bool> class TKernel>
+        void RampMatrixShaped(const FStereoMatrix& From, const FStereoMatrix& To, const float* InLeft, const float* InRight,
+            float* OutLeft, float* OutRight, int32 NumFrames)
+        {
+            if (NumFrames <= 0)
+            {
+                return;
+            }
+
+            const float InvNumFrames = 1.0f / static_cast<float>(NumFrames);
+            const FStereoMatrix Step{
+                (To.LeftToLeft - From.LeftToLeft) * InvNumFrames,
+                (To.RightToLeft - From.RightToLeft) * InvNumFrames,
+                (To.LeftToRight - From.LeftToRight) * InvNumFrames,
+                (To.RightToRight - From.RightToRight) * InvNumFrames
+            };
+
+            switch (GetRampShape(From.GetShape(), To.GetShape()))
+            {
+            case EStereoMatrixShape::Zero:
+                FMemory::Memzero(OutLeft, NumFrames * sizeof(float));
+                FMemory::Memzero(OutRight, NumFrames * sizeof(float));
+                break;
+
+            case EStereoMatrixShape::Direct:
+                TKernel<true, false>::Process(From, Step, InLeft, InRight, OutLeft, OutRight, 0, NumFrames);
+                break;
+
+            case EStereoMatrixShape::Cross:
+                TKernel<false, true>::Process(From, Step, InLeft, InRight, OutLeft, OutRight, 0, NumFrames);
+                break;
+
+            default:
+                TKernel<true, true>::Process(From, Step, InLeft, InRight, OutLeft, OutRight, 0, NumFrames);
+                break;
+            }
+        }
+
+        template<template<bool, bool> class TKernel>
+        void RampCrossfadeShaped(const FStereoCrossfade& From, const FStereoCrossfade& To, const float* InLeftA, const float* InRightA,
+            const float* InLeftB, const float* InRightB, float* OutLeft, float* OutRight, int32 NumFrames)
+        {
+            if (NumFrames <= 0)
+            {
+                return;
+            }
+
+            const float InvNumFrames = 1.0f / static_cast<float>(NumFrames);
+            const FStereoCrossfade Step{ (To.GainA - From.GainA) * InvNumFrames, (To.GainB - From.GainB) * InvNumFrames };
+
+            switch (GetRampShape(From.GetShape(), To.GetShape()))
+            {
+            case EStereoMatrixShape::Zero:
+                FMemory::Memzero(OutLeft, NumFrames * sizeof(float));
+                FMemory::Memzero(OutRight, NumFrames * sizeof(float));
+                break;
+
+            case EStereoMatrixShape::Direct:
+                TKernel<true, false>::Process(From, Step, InLeftA, InRightA, InLeftB, InRightB, OutLeft, OutRight, 0, NumFrames);
+                break;
+
+            case EStereoMatrixShape::Cross:
+                TKernel<false, true>::Process(From, Step, InLeftA, InRightA, InLeftB, InRightB, OutLeft, OutRight, 0, NumFrames);
+                break;
+
+            default:
+                TKernel<true, true>::Process(From, Step, InLeftA, InRightA, InLeftB, InRightB, OutLeft, OutRight, 0, NumFrames);
+                break;
+            }
+        }
+
+#if METASOUNDBRANCHES_DSP_X86_DISPATCH
+        template<bool bDirect, bool bCross>
+        METASOUNDBRANCHES_DSP_TARGET_AVX2 FORCEINLINE __m256 Mix(__m256 Direct, __m256 Same, __m256 Cross, __m256 Other)
+        {
+            if constexpr (bDirect && bCross)
+            {
+                return _mm256_fmadd_ps(Cross, Other, _mm256_mul_ps(Direct, Same));
+            }
+            else if constexpr (bDirect)
+            {
+                return _mm256_mul_ps(Direct, Same);
+            }
+            else
+            {
+                return _mm256_mul_ps(Cross, Other);
+            }
+        }
+
+        template<bool bDirect, bool bCross>
+        METASOUNDBRANCHES_DSP_TARGET_AVX512 FORCEINLINE __m512 Mix(__m512 Direct, __m512 Same, __m512 Cross, __m512 Other)
+        {
+            if constexpr (bDirect && bCross)
+            {
+                return _mm512_fmadd_ps(Cross, Other, _mm512_mul_ps(Direct, Same));
+            }
+            else if constexpr (bDirect)
+            {
+                return _mm512_mul_ps(Direct, Same);
+            }
+            else
+            {
+                return _mm512_mul_ps(Cross, Other);
+            }
+        }
+
+        template<bool bDirect, bool bCross>
+        struct TMatrixAVX2
+        {
+            METASOUNDBRANCHES_DSP_TARGET_AVX2 static void Process(const FStereoMatrix& Matrix, const float* InLeft, const float* InRight,
+                float* OutLeft, float* OutRight, int32 NumFrames)
+            {
+                const __m256 LL = _mm256_set1_ps(Matrix.LeftToLeft);
+                const __m256 RL = _mm256_set1_ps(Matrix.RightToLeft);
+                const __m256 LR = _mm256_set1_ps(Matrix.LeftToRight);
+                const __m256 RR = _mm256_set1_ps(Matrix.RightToRight);
+
+                int32 i = 0;
+
+                for (; i + 8 <= NumFrames; i += 8)
+                {
+                    const __m256 Left = _mm256_loadu_ps(InLeft + i);
+                    const __m256 Right = _mm256_loadu_ps(InRight + i);
+
+                    _mm256_storeu_ps(OutLeft + i, Mix<bDirect, bCross>(LL, Left, RL, Right));
+                    _mm256_storeu_ps(OutRight + i, Mix<bDirect, bCross>(RR, Right, LR, Left));
+                }
+
+                TMatrixScalar<bDirect, bCross>::Process(Matrix, InLeft + i, InRight + i, OutLeft + i, OutRight + i, NumFrames - i);
+            }
+        };
+
+        // The remainder runs as one masked step
+        template<bool bDirect, bool bCross>
+        struct TMatrixAVX512
+        {
+            METASOUNDBRANCHES_DSP_TARGET_AVX512 static void Process(const FStereoMatrix& Matrix, const float* InLeft, const float* InRight,
+                float* OutLeft, float* OutRight, int32 NumFrames)
+            {
+                const __m512 LL = _mm512_set1_ps(Matrix.LeftToLeft);
+                const __m512 RL = _mm512_set1_ps(Matrix.RightToLeft);
+                const __m512 LR = _mm512_set1_ps(Matrix.LeftToRight);
+                const __m512 RR = _mm512_set1_ps(Matrix.RightToRight);
+
+                for (int32 i = 0; i < NumFrames; i += 16)
+                {
+                    const __mmask16 Mask = (NumFrames - i >= 16) ? __mmask16(0xFFFF) : __mmask16((1u << (NumFrames - i)) - 1);
+
+                    const __m512 Left = _mm512_maskz_loadu_ps(Mask, InLeft + i);
+                    const __m512 Right = _mm512_maskz_loadu_ps(Mask, InRight + i);
+
+                    _mm512_mask_storeu_ps(OutLeft + i, Mask, Mix<bDirect, bCross>(LL, Left, RL, Right));
+                    _mm512_mask_storeu_ps(OutRight + i, Mask, Mix<bDirect, bCross>(RR, Right, LR, Left));
+                }
+            }
+        };
+
+        template<bool bA, bool bB>
+        struct TCrossfadeAVX2
+        {
+            METASOUNDBRANCHES_DSP_TARGET_AVX2 static void Process(const FStereoCrossfade& Crossfade, const float* InLeftA, const float* InRightA,
+                const float* InLeftB, const float* InRightB, float* OutLeft, float* OutRight, int32 NumFrames)
+            {
+                const __m256 A = _mm256_set1_ps(Crossfade.GainA);
+                const __m256 B = _mm256_set1_ps(Crossfade.GainB);
+
+                int32 i = 0;
+
+                for (; i + 8 <= NumFrames; i += 8)
+                {
+                    const __m256 LeftA = bA ? _mm256_loadu_ps(InLeftA + i) : A;
+                    const __m256 RightA = bA ? _mm256_loadu_ps(InRightA + i) : A;
+                    const __m256 LeftB = bB ? _mm256_loadu_ps(InLeftB + i) : B;
+                    const __m256 RightB = bB ? _mm256_loadu_ps(InRightB + i) : B;
+
+                    _mm256_storeu_ps(OutLeft + i, Mix<bA, bB>(A, LeftA, B, LeftB));
+                    _mm256_storeu_ps(OutRight + i, Mix<bA, bB>(A, RightA, B, RightB));
+                }
+
+                TCrossfadeScalar<bA, bB>::Process(Crossfade, InLeftA + i, InRightA + i, InLeftB + i, InRightB + i, OutLeft + i, OutRight + i, NumFrames - i);
+            }
+        };
+
+        template<bool bA, bool bB>
+        struct TCrossfadeAVX512
+        {
+            METASOUNDBRANCHES_DSP_TARGET_AVX512 static void Process(const FStereoCrossfade& Crossfade, const float* InLeftA, const float* InRightA,
+                const float* InLeftB, const float* InRightB, float* OutLeft, float* OutRight, int32 NumFrames)
+            {
+                const __m512 A = _mm512_set1_ps(Crossfade.GainA);
+                const __m512 B = _mm512_set1_ps(Crossfade.GainB);
+
+                for (int32 i = 0; i < NumFrames; i += 16)
+                {
+                    const __mmask16 Mask = (NumFrames - i >= 16) ? __mmask16(0xFFFF) : __mmask16((1u << (NumFrames - i)) - 1);
+
+                    const __m512 LeftA = bA ? _mm512_maskz_loadu_ps(Mask, InLeftA + i) : A;
+                    const __m512 RightA = bA ? _mm512_maskz_loadu_ps(Mask, InRightA + i) : A;
+                    const __m512 LeftB = bB ? _mm512_maskz_loadu_ps(Mask, InLeftB + i) : B;
+                    const __m512 RightB = bB ? _mm512_maskz_loadu_ps(Mask, InRightB + i) : B;
+
+                    _mm512_mask_storeu_ps(OutLeft + i, Mask, Mix<bA, bB>(A, LeftA, B, LeftB));
+                    _mm512_mask_storeu_ps(OutRight + i, Mask, Mix<bA, bB>(A, RightA, B, RightB));
+                }
+            }
+        };
+
+        // Ramps have no AVX-512 loops: they run for one block after a control change, so AVX-512 uses these
+        template<bool bDirect, bool bCross>
+        struct TMatrixRampAVX2
+        {
+            METASOUNDBRANCHES_DSP_TARGET_AVX2 static void Process(const FStereoMatrix& From, const FStereoMatrix& Step, const float* InLeft, const float* InRight,
+                float* OutLeft, float* OutRight, int32 StartFrame, int32 NumFrames)
+            {
+                const __m256 LL = _mm256_set1_ps(From.LeftToLeft);
+                const __m256 RL = _mm256_set1_ps(From.RightToLeft);
+                const __m256 LR = _mm256_set1_ps(From.LeftToRight);
+                const __m256 RR = _mm256_set1_ps(From.RightToRight);
+
+                const __m256 StepLL = _mm256_set1_ps(Step.LeftToLeft);
+                const __m256 StepRL = _mm256_set1_ps(Step.RightToLeft);
+                const __m256 StepLR = _mm256_set1_ps(Step.LeftToRight);
+                const __m256 StepRR = _mm256_set1_ps(Step.RightToRight);
+
+                const __m256 Eight = _mm256_set1_ps(8.0f);
+                __m256 Frame = _mm256_add_ps(_mm256_setr_ps(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f), _mm256_set1_ps(static_cast<float>(StartFrame)));
+
+                int32 i = StartFrame;
+
+                for (; i + 8 <= NumFrames; i += 8)
+                {
+                    const __m256 Left = _mm256_loadu_ps(InLeft + i);
+                    const __m256 Right = _mm256_loadu_ps(InRight + i);
+
+                    _mm256_storeu_ps(OutLeft + i, Mix<bDirect, bCross>(_mm256_fmadd_ps(StepLL, Frame, LL), Left, _mm256_fmadd_ps(StepRL, Frame, RL), Right));
+                    _mm256_storeu_ps(OutRight + i, Mix<bDirect, bCross>(_mm256_fmadd_ps(StepRR, Frame, RR), Right, _mm256_fmadd_ps(StepLR, Frame, LR), Left));
+
+                    Frame = _mm256_add_ps(Frame, Eight);
+                }
+
+                TMatrixRampScalar<bDirect, bCross>::Process(From, Step, InLeft, InRight, OutLeft, OutRight, i, NumFrames);
+            }
+        };
+
+        template<bool bA, bool bB>
+        struct TCrossfadeRampAVX2
+        {
+            METASOUNDBRANCHES_DSP_TARGET_AVX2 static void Process(const FStereoCrossfade& From, const FStereoCrossfade& Step, const float* InLeftA, const float* InRightA,
+                const float* InLeftB, const float* InRightB, float* OutLeft, float* OutRight, int32 StartFrame, int32 NumFrames)
+            {
+                const __m256 FromA = _mm256_set1_ps(From.GainA);
+                const __m256 FromB = _mm256_set1_ps(From.GainB);
+                const __m256 StepA = _mm256_set1_ps(Step.GainA);
+                const __m256 StepB = _mm256_set1_ps(Step.GainB);
+
+                const __m256 Eight = _mm256_set1_ps(8.0f);
+                __m256 Frame = _mm256_add_ps(_mm256_setr_ps(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f), _mm256_set1_ps(static_cast<float>(StartFrame)));
+
+                int32 i = StartFrame;
+
+                for (; i + 8 <= NumFrames; i += 8)
+                {
+                    const __m256 A = _mm256_fmadd_ps(StepA, Frame, FromA);
+                    const __m256 B = _mm256_fmadd_ps(StepB, Frame, FromB);
+
+                    const __m256 LeftA = bA ? _mm256_loadu_ps(InLeftA + i) : A;
+                    const __m256 RightA = bA ? _mm256_loadu_ps(InRightA + i) : A;
+                    const __m256 LeftB = bB ? _mm256_loadu_ps(InLeftB + i) : B;
+                    const __m256 RightB = bB ? _mm256_loadu_ps(InRightB + i) : B;
+
+                    _mm256_storeu_ps(OutLeft + i, Mix<bA, bB>(A, LeftA, B, LeftB));
+                    _mm256_storeu_ps(OutRight + i, Mix<bA, bB>(A, RightA, B, RightB));
+
+                    Frame = _mm256_add_ps(Frame, Eight);
+                }
+
+                TCrossfadeRampScalar<bA, bB>::Process(From, Step, InLeftA, InRightA, InLeftB, InRightB, OutLeft, OutRight, i, NumFrames);
+            }
+        };
+#endif
+    }
+
+    FStereoMatrix FStereoMatrix::Gain(float InGain)
+    {
+        return { InGain, 0.0f, 0.0f, InGain };
+    }
+
+    FStereoMatrix FStereoMatrix::Balance(float InBalance)
+    {
+        const float Angle = (FMath::Clamp(InBalance, -1.0f, 1.0f) + 1.0f) * (UE_PI / 4.0f);
+        return { FMath::Cos(Angle), 0.0f, 0.0f, FMath::Sin(Angle) };
+    }
+
+    FStereoMatrix FStereoMatrix::Width(float InWidth)
+    {
+        // Mid + width * side, with mid and side each half the sum and difference
+        const float Width = FMath::Clamp(InWidth, 0.0f, 2.0f);
+        const float Direct = 0.5f * (1.0f + Width);
+        const float Cross = 0.5f * (1.0f - Width);
+        return { Direct, Cross, Cross, Direct };
+    }
+
+    FStereoMatrix FStereoMatrix::Inverter(bool bInvertLeft, bool bInvertRight, bool bSwapChannels)
+    {
+        const float LeftSign = bInvertLeft ? -1.0f : 1.0f;
+        const float RightSign = bInvertRight ? -1.0f : 1.0f;
+
+        return bSwapChannels
+            ? FStereoMatrix{ 0.0f, LeftSign, RightSign, 0.0f }
+            : FStereoMatrix{ LeftSign, 0.0f, 0.0f, RightSign };
+    }
+
+    FStereoMatrix FStereoMatrix::Then(const FStereoMatrix& Next) const
+    {
+        return {
+            Next.LeftToLeft * LeftToLeft + Next.RightToLeft * LeftToRight,
+            Next.LeftToLeft * RightToLeft + Next.RightToLeft * RightToRight,
+            Next.LeftToRight * LeftToLeft + Next.RightToRight * LeftToRight,
+            Next.LeftToRight * RightToLeft + Next.RightToRight * RightToRight
+        };
+    }
+
+    EStereoMatrixShape FStereoMatrix::GetShape() const
+    {
+        const bool bDirect = (LeftToLeft != 0.0f) || (RightToRight != 0.0f);
+        const bool bCross = (RightToLeft != 0.0f) || (LeftToRight != 0.0f);
+
+        return static_cast<EStereoMatrixShape>((bDirect ? 1 : 0) | (bCross ? 2 : 0));
+    }
+
+    void FStereoMatrix::Process(const float* InLeft, const float* InRight, float* OutLeft, float* OutRight, int32 NumFrames) const
+    {
+        StereoMatrixPrivate::ProcessMatrixShaped<StereoMatrixPrivate::TMatrixVector>(*this, InLeft, InRight, OutLeft, OutRight, NumFrames);
+    }
+
+    FStereoMatrix::FProcessFunction FStereoMatrix::GetProcessFunction(ESimdLevel Level)
+    {
+        using namespace StereoMatrixPrivate;
+
+#if METASOUNDBRANCHES_DSP_X86_DISPATCH
+        if (Level >= ESimdLevel::AVX512)
+        {
+            return &ProcessMatrixShaped<TMatrixAVX512>;
+        }
+        if (Level >= ESimdLevel::AVX2)
+        {
+            return &ProcessMatrixShaped<TMatrixAVX2>;
+        }
+#endif
+        return (Level == ESimdLevel::Scalar) ? &ProcessMatrixShaped<TMatrixScalar> : &ProcessMatrixShaped<TMatrixVector>;
+    }
+
+    FStereoMatrix::FRampFunction FStereoMatrix::GetRampFunction(ESimdLevel Level)
+    {
+        using namespace StereoMatrixPrivate;
+
+#if METASOUNDBRANCHES_DSP_X86_DISPATCH
+        if (Level >= ESimdLevel::AVX2)
+        {
+            return &RampMatrixShaped<TMatrixRampAVX2>;
+        }
+#endif
+        return (Level == ESimdLevel::Scalar) ? &RampMatrixShaped<TMatrixRampScalar> : &RampMatrixShaped<TMatrixRampVector>;
+    }
+
+    FStereoCrossfade FStereoCrossfade::Position(float InCrossfade)
+    {
+        const float Angle = FMath::Clamp(InCrossfade, 0.0f, 1.0f) * UE_HALF_PI;
+        return { FMath::Cos(Angle), FMath::Sin(Angle) };
+    }
+
+    EStereoMatrixShape FStereoCrossfade::GetShape() const
+    {
+        return static_cast<EStereoMatrixShape>((GainA != 0.0f ? 1 : 0) | (GainB != 0.0f ? 2 : 0));
+    }
+
+    void FStereoCrossfade::Process(const float* InLeftA, const float* InRightA, const float* InLeftB, const float* InRightB,
+        float* OutLeft, float* OutRight, int32 NumFrames) const
+    {
+        StereoMatrixPrivate::ProcessCrossfadeShaped<StereoMatrixPrivate::TCrossfadeVector>(*this, InLeftA, InRightA, InLeftB, InRightB, OutLeft, OutRight, NumFrames);
+    }
+
+    FStereoCrossfade::FProcessFunction FStereoCrossfade::GetProcessFunction(ESimdLevel Level)
+    {
+        using namespace StereoMatrixPrivate;
+
+#if METASOUNDBRANCHES_DSP_X86_DISPATCH
+        if (Level >= ESimdLevel::AVX512)
+        {
+            return &ProcessCrossfadeShaped<TCrossfadeAVX512>;
+        }
+        if (Level >= ESimdLevel::AVX2)
+        {
+            return &ProcessCrossfadeShaped<TCrossfadeAVX2>;
+        }
+#endif
+        return (Level == ESimdLevel::Scalar) ? &ProcessCrossfadeShaped<TCrossfadeScalar> : &ProcessCrossfadeShaped<TCrossfadeVector>;
+    }
+
+    FStereoCrossfade::FRampFunction FStereoCrossfade::GetRampFunction(ESimdLevel Level)
+    {
+        using namespace StereoMatrixPrivate;
+
+#if METASOUNDBRANCHES_DSP_X86_DISPATCH
+        if (Level >= ESimdLevel::AVX2)
+        {
+            return &RampCrossfadeShaped<TCrossfadeRampAVX2>;
+        }
+#endif
+        return (Level == ESimdLevel::Scalar) ? &RampCrossfadeShaped<TCrossfadeRampScalar> : &RampCrossfadeShaped<TCrossfadeRampVector>;
+    }
+}
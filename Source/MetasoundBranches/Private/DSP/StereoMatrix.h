@@ -0,0 +1,112 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundBranches/Private/DSP/DSPCore.h"
+#include "MetasoundBranches/Private/DSP/SimdDispatch.h"
+
+namespace MetasoundBranches
+{
+    // Which terms of a matrix are non-zero. Each shape gets its own loop, picked once per block, so a gain or
+    // polarity matrix skips the cross terms, a channel swap skips the direct ones and a zero matrix reads nothing.
+    enum class EStereoMatrixShape : uint8
+    {
+        Zero = 0,
+
+        // LeftToLeft and RightToRight (or, for a crossfade, input A) only
+        Direct = 1,
+
+        // RightToLeft and LeftToRight (or input B) only
+        Cross = 2,
+
+        Full = Direct | Cross,
+    };
+
+    // A 2x2 gain matrix applied to a stereo pair:
+    // OutL = LeftToLeft * L + RightToLeft * R, OutR = LeftToRight * L + RightToRight * R.
+    // Gain, balance, width and polarity/swap are all instances of it, so they share one SIMD loop.
+    struct FStereoMatrix
+    {
+        float LeftToLeft = 1.0f;
+        float RightToLeft = 0.0f;
+        float LeftToRight = 0.0f;
+        float RightToRight = 1.0f;
+
+        // Input channels: one stereo pair
+        static constexpr int32 NumInputs = 2;
+
+        // The same gain on both channels
+        static FStereoMatrix Gain(float InGain);
+
+        // Equal-power balance, -1 (full left) to 1 (full right)
+        static FStereoMatrix Balance(float InBalance);
+
+        // Mid/side width, 0 (mono) to 2 (double width); 1 leaves the signal unchanged
+        static FStereoMatrix Width(float InWidth);
+
+        // Per-channel polarity inversion, applied after an optional channel swap
+        static FStereoMatrix Inverter(bool bInvertLeft, bool bInvertRight, bool bSwapChannels);
+
+        // This matrix followed by Next, as one matrix: processing with it matches a chain of the two nodes, up to
+        // float rounding
+        FStereoMatrix Then(const FStereoMatrix& Next) const;
+
+        EStereoMatrixShape GetShape() const;
+
+        void Process(const float* InLeft, const float* InRight, float* OutLeft, float* OutRight, int32 NumFrames) const;
+
+        using FProcessFunction = void (*)(const FStereoMatrix& Matrix, const float* InLeft, const float* InRight,
+            float* OutLeft, float* OutRight, int32 NumFrames);
+
+        // Process() built for the given SIMD level; pick once, when the operator is created. In-place use is safe.
+        static FProcessFunction GetProcessFunction(ESimdLevel Level);
+
+        // Moves linearly from one matrix to another across the block, each frame one step further, so the last
+        // frame lands on To. For a control that changed since the previous block; see TStereoMatrixRamp.
+        using FRampFunction = void (*)(const FStereoMatrix& From, const FStereoMatrix& To, const float* InLeft, const float* InRight,
+            float* OutLeft, float* OutRight, int32 NumFrames);
+
+        static FRampFunction GetRampFunction(ESimdLevel Level);
+
+        bool operator==(const FStereoMatrix& Other) const
+        {
+            return LeftToLeft == Other.LeftToLeft && RightToLeft == Other.RightToLeft
+                && LeftToRight == Other.LeftToRight && RightToRight == Other.RightToRight;
+        }
+    };
+
+    // Equal-power crossfade between two stereo pairs, 0 (all A) to 1 (all B): the 2x4 matrix that weights
+    // each pair and sums them channel by channel
+    struct FStereoCrossfade
+    {
+        float GainA = 1.0f;
+        float GainB = 0.0f;
+
+        // Input channels: pair A, then pair B
+        static constexpr int32 NumInputs = 4;
+
+        static FStereoCrossfade Position(float InCrossfade);
+
+        EStereoMatrixShape GetShape() const;
+
+        void Process(const float* InLeftA, const float* InRightA, const float* InLeftB, const float* InRightB,
+            float* OutLeft, float* OutRight, int32 NumFrames) const;
+
+        using FProcessFunction = void (*)(const FStereoCrossfade& Crossfade, const float* InLeftA, const float* InRightA,
+            const float* InLeftB, const float* InRightB, float* OutLeft, float* OutRight, int32 NumFrames);
+
+        // Process() built for the given SIMD level; pick once, when the operator is created
+        static FProcessFunction GetProcessFunction(ESimdLevel Level);
+
+        // Moves linearly from one pair of gains to another across the block, as FStereoMatrix::FRampFunction
+        using FRampFunction = void (*)(const FStereoCrossfade& From, const FStereoCrossfade& To, const float* InLeftA, const float* InRightA,
+            const float* InLeftB, const float* InRightB, float* OutLeft, float* OutRight, int32 NumFrames);
+
+        static FRampFunction GetRampFunction(ESimdLevel Level);
+
+        bool operator==(const FStereoCrossfade& Other) const
+        {
+            return GainA == Other.GainA && GainB == Other.GainB;
+        }
+    };
+}
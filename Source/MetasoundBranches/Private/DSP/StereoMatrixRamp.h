@@ -0,0 +1,105 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundBranches/Private/DSP/StereoMatrix.h"
+#include "MetasoundBranches/Private/DSP/StereoModulation.h"
+
+namespace MetasoundBranches
+{
+    // Runs a node's matrix block after block without zipper noise. A block whose matrix differs from the previous
+    // block's ramps linearly from the old matrix to the new one; an unchanged matrix takes the constant loop, so a
+    // steady control costs one comparison per block. The first block after construction or Reset() starts on its
+    // own matrix, with nothing to ramp from.
+    //
+    // MatrixType is FStereoMatrix or FStereoCrossfade, or one of the audio-rate signal types, which already change
+    // every frame and so are passed straight to their process function.
+    template<typename MatrixType>
+    class TStereoMatrixRamp
+    {
+    public:
+        explicit TStereoMatrixRamp(ESimdLevel Level)
+            : ProcessMatrix(MatrixType::GetProcessFunction(Level))
+            , RampMatrix(MatrixType::GetRampFunction(Level))
+        {
+        }
+
+        // One block: the inputs, outputs and frame count are those of MatrixType's process function
+        template<typename... ArgTypes>
+        void Process(const MatrixType& Matrix, ArgTypes... Args)
+        {
+            if (bHasPrevious && !(Matrix == Previous))
+            {
+                RampMatrix(Previous, Matrix, Args...);
+            }
+            else
+            {
+                ProcessMatrix(Matrix, Args...);
+            }
+
+            Previous = Matrix;
+            bHasPrevious = true;
+        }
+
+        // For a block that was not processed (e.g. silent input), so the next one ramps from where the control
+        // is now rather than from where it was before the gap
+        void Skip(const MatrixType& Matrix)
+        {
+            Previous = Matrix;
+            bHasPrevious = true;
+        }
+
+        void Reset()
+        {
+            bHasPrevious = false;
+        }
+
+    private:
+        typename MatrixType::FProcessFunction ProcessMatrix;
+        typename MatrixType::FRampFunction RampMatrix;
+
+        MatrixType Previous;
+        bool bHasPrevious = false;
+    };
+
+    template<typename SignalType>
+    class TStereoMatrixSignalPassThrough
+    {
+    public:
+        explicit TStereoMatrixSignalPassThrough(ESimdLevel Level)
+            : ProcessSignal(SignalType::GetProcessFunction(Level))
+        {
+        }
+
+        template<typename... ArgTypes>
+        void Process(const SignalType& Signal, ArgTypes... Args)
+        {
+            ProcessSignal(Signal, Args...);
+        }
+
+        void Skip(const SignalType& Signal)
+        {
+        }
+
+        void Reset()
+        {
+        }
+
+    private:
+        typename SignalType::FProcessFunction ProcessSignal;
+    };
+
+    template<EStereoMatrixLaw Law>
+    class TStereoMatrixRamp<TStereoMatrixSignal<Law>> : public TStereoMatrixSignalPassThrough<TStereoMatrixSignal<Law>>
+    {
+    public:
+        using TStereoMatrixSignalPassThrough<TStereoMatrixSignal<Law>>::TStereoMatrixSignalPassThrough;
+    };
+
+    template<>
+    class TStereoMatrixRamp<FStereoCrossfadeSignal> : public TStereoMatrixSignalPassThrough<FStereoCrossfadeSignal>
+    {
+    public:
+        using TStereoMatrixSignalPassThrough<FStereoCrossfadeSignal>::TStereoMatrixSignalPassThrough;
+    };
+}
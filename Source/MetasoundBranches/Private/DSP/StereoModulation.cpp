@@ -0,0 +1,289 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Private/DSP/StereoModulation.h"
+#include "MetasoundBranches/Private/DSP/FastMath.h"
+
+namespace MetasoundBranches
+{
+    namespace StereoModulationPrivate
+    {
+        // One frame of a law: the output pair for a control value and an input pair, with an overload per register
+        // width. Each matches the arithmetic of the FStereoMatrix constructor it follows.
+        template<EStereoMatrixLaw Law>
+        FORCEINLINE void ApplyLaw(float Control, float Left, float Right, float& OutLeft, float& OutRight)
+        {
+            if constexpr (Law == EStereoMatrixLaw::Gain)
+            {
+                OutLeft = Control * Left;
+                OutRight = Control * Right;
+            }
+            else if constexpr (Law == EStereoMatrixLaw::Balance)
+            {
+                const float Position = 0.5f * FMath::Clamp(Control, -1.0f, 1.0f) + 0.5f;
+
+                OutLeft = FastMath::SinQuarterCycle(1.0f - Position) * Left;
+                OutRight = FastMath::SinQuarterCycle(Position) * Right;
+            }
+            else
+            {
+                const float Width = FMath::Clamp(Control, 0.0f, 2.0f);
+                const float Direct = 0.5f * (1.0f + Width);
+                const float Cross = 0.5f * (1.0f - Width);
+
+                OutLeft = Direct * Left + Cross * Right;
+                OutRight = Direct * Right + Cross * Left;
+            }
+        }
+
+        template<EStereoMatrixLaw Law>
+        FORCEINLINE void ApplyLaw(const VectorRegister4Float& Control, const VectorRegister4Float& Left, const VectorRegister4Float& Right,
+            VectorRegister4Float& OutLeft, VectorRegister4Float& OutRight)
+        {
+            if constexpr (Law == EStereoMatrixLaw::Gain)
+            {
+                OutLeft = VectorMultiply(Control, Left);
+                OutRight = VectorMultiply(Control, Right);
+            }
+            else if constexpr (Law == EStereoMatrixLaw::Balance)
+            {
+                const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+                const VectorRegister4Float Clamped = VectorMin(VectorMax(Control, VectorSetFloat1(-1.0f)), VectorSetFloat1(1.0f));
+                const VectorRegister4Float Position = VectorMultiplyAdd(Clamped, Half, Half);
+
+                OutLeft = VectorMultiply(FastMath::SinQuarterCycle(VectorSubtract(VectorSetFloat1(1.0f), Position)), Left);
+                OutRight = VectorMultiply(FastMath::SinQuarterCycle(Position), Right);
+            }
+            else
+            {
+                const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+                const VectorRegister4Float Width = VectorMin(VectorMax(Control, VectorSetFloat1(0.0f)), VectorSetFloat1(2.0f));
+                const VectorRegister4Float Direct = VectorMultiplyAdd(Width, Half, Half);
+                const VectorRegister4Float Cross = VectorNegateMultiplyAdd(Width, Half, Half);
+
+                OutLeft = VectorMultiplyAdd(Cross, Right, VectorMultiply(Direct, Left));
+                OutRight = VectorMultiplyAdd(Cross, Left, VectorMultiply(Direct, Right));
+            }
+        }
+
+        // Equal-power gains for a crossfade position
+        FORCEINLINE void GetCrossfadeGains(float Control, float& OutGainA, float& OutGainB)
+        {
+            const float Position = FMath::Clamp(Control, 0.0f, 1.0f);
+
+            OutGainA = FastMath::SinQuarterCycle(1.0f - Position);
+            OutGainB = FastMath::SinQuarterCycle(Position);
+        }
+
+        FORCEINLINE void GetCrossfadeGains(const VectorRegister4Float& Control, VectorRegister4Float& OutGainA, VectorRegister4Float& OutGainB)
+        {
+            const VectorRegister4Float Position = VectorMin(VectorMax(Control, VectorSetFloat1(0.0f)), VectorSetFloat1(1.0f));
+
+            OutGainA = FastMath::SinQuarterCycle(VectorSubtract(VectorSetFloat1(1.0f), Position));
+            OutGainB = FastMath::SinQuarterCycle(Position);
+        }
+
+        // The scalar loops also finish the blocks of the wider ones. They are force-inlined so that remainder is
+        // compiled for the caller's instruction set: an AVX2 loop calling out to SSE code with the upper halves of
+        // its registers still dirty pays a state transition on every block.
+        template<EStereoMatrixLaw Law>
+        FORCEINLINE void ProcessSignalScalar(const TStereoMatrixSignal<Law>& Signal, const float* InLeft, const float* InRight,
+            float* OutLeft, float* OutRight, int32 NumFrames)
+        {
+            const float* Control = Signal.Control;
+
+            for (int32 i = 0; i < NumFrames; ++i)
+            {
+                const float Left = InLeft[i];
+                const float Right = InRight[i];
+
+                ApplyLaw<Law>(Control[i], Left, Right, OutLeft[i], OutRight[i]);
+            }
+        }
+
+        template<EStereoMatrixLaw Law>
+        void ProcessSignalVector(const TStereoMatrixSignal<Law>& Signal, const float* InLeft, const float* InRight,
+            float* OutLeft, float* OutRight, int32 NumFrames)
+        {
+            const float* Control = Signal.Control;
+
+            int32 i = 0;
+
+            for (; i + 4 <= NumFrames; i += 4)
+            {
+                VectorRegister4Float Left;
+                VectorRegister4Float Right;
+                ApplyLaw<Law>(VectorLoad(Control + i), VectorLoad(InLeft + i), VectorLoad(InRight + i), Left, Right);
+
+                VectorStore(Left, OutLeft + i);
+                VectorStore(Right, OutRight + i);
+            }
+
+            const TStereoMatrixSignal<Law> Remainder{ Control + i };
+            ProcessSignalScalar<Law>(Remainder, InLeft + i, InRight + i, OutLeft + i, OutRight + i, NumFrames - i);
+        }
+
+        FORCEINLINE void ProcessCrossfadeSignalScalar(const FStereoCrossfadeSignal& Signal, const float* InLeftA, const float* InRightA,
+            const float* InLeftB, const float* InRightB, float* OutLeft, float* OutRight, int32 NumFrames)
+        {
+            const float* Control = Signal.Control;
+
+            for (int32 i = 0; i < NumFrames; ++i)
+            {
+                float GainA;
+                float GainB;
+                GetCrossfadeGains(Control[i], GainA, GainB);
+
+                const float LeftA = InLeftA[i];
+                const float RightA = InRightA[i];
+                const float LeftB = InLeftB[i];
+                const float RightB = InRightB[i];
+
+                OutLeft[i] = GainA * LeftA + GainB * LeftB;
+                OutRight[i] = GainA * RightA + GainB * RightB;
+            }
+        }
+
+        void ProcessCrossfadeSignalVector(const FStereoCrossfadeSignal& Signal, const float* InLeftA, const float* InRightA,
+            const float* InLeftB, const float* InRightB, float* OutLeft, float* OutRight, int32 NumFrames)
+        {
+            const float* Control = Signal.Control;
+
+            int32 i = 0;
+
+            for (; i + 4 <= NumFrames; i += 4)
+            {
+                VectorRegister4Float GainA;
+                VectorRegister4Float GainB;
+                GetCrossfadeGains(VectorLoad(Control + i), GainA, GainB);
+
+                const VectorRegister4Float Left = VectorMultiplyAdd(GainB, VectorLoad(InLeftB + i), VectorMultiply(GainA, VectorLoad(InLeftA + i)));
+                const VectorRegister4Float Right = VectorMultiplyAdd(GainB, VectorLoad(InRightB + i), VectorMultiply(GainA, VectorLoad(InRightA + i)));
+
+                VectorStore(Left, OutLeft + i);
+                VectorStore(Right, OutRight + i);
+            }
+
+            const FStereoCrossfadeSignal Remainder{ Control + i };
+            ProcessCrossfadeSignalScalar(Remainder, InLeftA + i, InRightA + i, InLeftB + i, InRightB + i, OutLeft + i, OutRight + i, NumFrames - i);
+        }
+
+#if METASOUNDBRANCHES_DSP_X86_DISPATCH
+        template<EStereoMatrixLaw Law>
+        METASOUNDBRANCHES_DSP_TARGET_AVX2 FORCEINLINE void ApplyLaw(__m256 Control, __m256 Left, __m256 Right, __m256& OutLeft, __m256& OutRight)
+        {
+            if constexpr (Law == EStereoMatrixLaw::Gain)
+            {
+                OutLeft = _mm256_mul_ps(Control, Left);
+                OutRight = _mm256_mul_ps(Control, Right);
+            }
+            else if constexpr (Law == EStereoMatrixLaw::Balance)
+            {
+                const __m256 Half = _mm256_set1_ps(0.5f);
+                const __m256 Clamped = _mm256_min_ps(_mm256_max_ps(Control, _mm256_set1_ps(-1.0f)), _mm256_set1_ps(1.0f));
+                const __m256 Position = _mm256_fmadd_ps(Clamped, Half, Half);
+
+                OutLeft = _mm256_mul_ps(FastMath::SinQuarterCycle(_mm256_sub_ps(_mm256_set1_ps(1.0f), Position)), Left);
+                OutRight = _mm256_mul_ps(FastMath::SinQuarterCycle(Position), Right);
+            }
+            else
+            {
+                const __m256 Half = _mm256_set1_ps(0.5f);
+                const __m256 Width = _mm256_min_ps(_mm256_max_ps(Control, _mm256_setzero_ps()), _mm256_set1_ps(2.0f));
+                const __m256 Direct = _mm256_fmadd_ps(Width, Half, Half);
+                const __m256 Cross = _mm256_fnmadd_ps(Width, Half, Half);
+
+                OutLeft = _mm256_fmadd_ps(Cross, Right, _mm256_mul_ps(Direct, Left));
+                OutRight = _mm256_fmadd_ps(Cross, Left, _mm256_mul_ps(Direct, Right));
+            }
+        }
+
+        METASOUNDBRANCHES_DSP_TARGET_AVX2 FORCEINLINE void GetCrossfadeGains(__m256 Control, __m256& OutGainA, __m256& OutGainB)
+        {
+            const __m256 Position = _mm256_min_ps(_mm256_max_ps(Control, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+
+            OutGainA = FastMath::SinQuarterCycle(_mm256_sub_ps(_mm256_set1_ps(1.0f), Position));
+            OutGainB = FastMath::SinQuarterCycle(Position);
+        }
+
+        template<EStereoMatrixLaw Law>
+        METASOUNDBRANCHES_DSP_TARGET_AVX2 void ProcessSignalAVX2(const TStereoMatrixSignal<Law>& Signal, const float* InLeft, const float* InRight,
+            float* OutLeft, float* OutRight, int32 NumFrames)
+        {
+            const float* Control = Signal.Control;
+
+            int32 i = 0;
+
+            for (; i + 8 <= NumFrames; i += 8)
+            {
+                __m256 Left;
+                __m256 Right;
+                ApplyLaw<Law>(_mm256_loadu_ps(Control + i), _mm256_loadu_ps(InLeft + i), _mm256_loadu_ps(InRight + i), Left, Right);
+
+                _mm256_storeu_ps(OutLeft + i, Left);
+                _mm256_storeu_ps(OutRight + i, Right);
+            }
+
+            const TStereoMatrixSignal<Law> Remainder{ Control + i };
+            ProcessSignalScalar<Law>(Remainder, InLeft + i, InRight + i, OutLeft + i, OutRight + i, NumFrames - i);
+        }
+
+        METASOUNDBRANCHES_DSP_TARGET_AVX2 void ProcessCrossfadeSignalAVX2(const FStereoCrossfadeSignal& Signal, const float* InLeftA, const float* InRightA,
+            const float* InLeftB, const float* InRightB, float* OutLeft, float* OutRight, int32 NumFrames)
+        {
+            const float* Control = Signal.Control;
+
+            int32 i = 0;
+
+            for (; i + 8 <= NumFrames; i += 8)
+            {
+                __m256 GainA;
+                __m256 GainB;
+                GetCrossfadeGains(_mm256_loadu_ps(Control + i), GainA, GainB);
+
+                const __m256 Left = _mm256_fmadd_ps(GainB, _mm256_loadu_ps(InLeftB + i), _mm256_mul_ps(GainA, _mm256_loadu_ps(InLeftA + i)));
+                const __m256 Right = _mm256_fmadd_ps(GainB, _mm256_loadu_ps(InRightB + i), _mm256_mul_ps(GainA, _mm256_loadu_ps(InRightA + i)));
+
+                _mm256_storeu_ps(OutLeft + i, Left);
+                _mm256_storeu_ps(OutRight + i, Right);
+            }
+
+            const FStereoCrossfadeSignal Remainder{ Control + i };
+            ProcessCrossfadeSignalScalar(Remainder, InLeftA + i, InRightA + i, InLeftB + i, InRightB + i, OutLeft + i, OutRight + i, NumFrames - i);
+        }
+#endif
+    }
+
+    // No AVX-512 versions, so the AVX-512 level runs the AVX2 loops. Balance and crossfade are compute-bound on the
+    // SinQuarterCycle polynomial, but at AVX2 that already costs under half a nanosecond a frame; gain and width
+    // cost about what the constant matrices do.
+    template<EStereoMatrixLaw Law>
+    typename TStereoMatrixSignal<Law>::FProcessFunction TStereoMatrixSignal<Law>::GetProcessFunction(ESimdLevel Level)
+    {
+        using namespace StereoModulationPrivate;
+
+#if METASOUNDBRANCHES_DSP_X86_DISPATCH
+        if (Level >= ESimdLevel::AVX2)
+        {
+            return &ProcessSignalAVX2<Law>;
+        }
+#endif
+        return (Level == ESimdLevel::Scalar) ? &ProcessSignalScalar<Law> : &ProcessSignalVector<Law>;
+    }
+
+    template struct TStereoMatrixSignal<EStereoMatrixLaw::Gain>;
+    template struct TStereoMatrixSignal<EStereoMatrixLaw::Balance>;
+    template struct TStereoMatrixSignal<EStereoMatrixLaw::Width>;
+
+    FStereoCrossfadeSignal::FProcessFunction FStereoCrossfadeSignal::GetProcessFunction(ESimdLevel Level)
+    {
+        using namespace StereoModulationPrivate;
+
+#if METASOUNDBRANCHES_DSP_X86_DISPATCH
+        if (Level >= ESimdLevel::AVX2)
+        {
+            return &ProcessCrossfadeSignalAVX2;
+        }
+#endif
+        return (Level == ESimdLevel::Scalar) ? &ProcessCrossfadeSignalScalar : &ProcessCrossfadeSignalVector;
+    }
+}
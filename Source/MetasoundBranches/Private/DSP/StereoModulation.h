@@ -0,0 +1,57 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundBranches/Private/DSP/DSPCore.h"
+#include "MetasoundBranches/Private/DSP/SimdDispatch.h"
+
+namespace MetasoundBranches
+{
+    // The parameter laws of FStereoMatrix's constructors, applied per frame
+    enum class EStereoMatrixLaw : uint8
+    {
+        Gain,
+        Balance,
+        Width,
+    };
+
+    // Audio-rate counterpart of FStereoMatrix: the control signal's value at each frame sets that frame's matrix,
+    // through the same law and clamping as the constant version. The matrix is worked out in registers in the same
+    // pass that applies it, so modulation costs about as much as a constant matrix. Balance uses
+    // FastMath::SinQuarterCycle for its equal-power gains.
+    template<EStereoMatrixLaw Law>
+    struct TStereoMatrixSignal
+    {
+        // One value per frame
+        const float* Control = nullptr;
+
+        // Input channels: one stereo pair
+        static constexpr int32 NumInputs = 2;
+
+        using FProcessFunction = void (*)(const TStereoMatrixSignal& Signal, const float* InLeft, const float* InRight,
+            float* OutLeft, float* OutRight, int32 NumFrames);
+
+        // Built for the given SIMD level; pick once, when the operator is created. In-place use is safe.
+        static FProcessFunction GetProcessFunction(ESimdLevel Level);
+    };
+
+    using FStereoGainSignal = TStereoMatrixSignal<EStereoMatrixLaw::Gain>;
+    using FStereoBalanceSignal = TStereoMatrixSignal<EStereoMatrixLaw::Balance>;
+    using FStereoWidthSignal = TStereoMatrixSignal<EStereoMatrixLaw::Width>;
+
+    // Audio-rate counterpart of FStereoCrossfade, with the control signal giving each frame's position
+    struct FStereoCrossfadeSignal
+    {
+        // One position per frame
+        const float* Control = nullptr;
+
+        // Input channels: pair A, then pair B
+        static constexpr int32 NumInputs = 4;
+
+        using FProcessFunction = void (*)(const FStereoCrossfadeSignal& Signal, const float* InLeftA, const float* InRightA,
+            const float* InLeftB, const float* InRightB, float* OutLeft, float* OutRight, int32 NumFrames);
+
+        // Built for the given SIMD level; pick once, when the operator is created
+        static FProcessFunction GetProcessFunction(ESimdLevel Level);
+    };
+}
@@ -1,6 +1,8 @@
 // Copyright 2025 Charles Matthews. All Rights Reserved.
 
 #include "MetasoundBranches/Public/MetasoundBoolToAudioNode.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
+#include "MetasoundBranches/Private/DSP/OnePoleSmoother.h"
 #include "MetasoundExecutableOperator.h"
 #include "MetasoundPrimitives.h"
 #include "MetasoundNodeRegistrationMacro.h"
@@ -10,6 +12,8 @@
 
 #define LOCTEXT_NAMESPACE "MetasoundBoolToAudioNode"
 
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FBoolToAudioOperator);
+
 namespace Metasound
 {
     namespace BoolToAudioNodeNames
@@ -32,8 +36,7 @@ namespace Metasound
             , InputRiseTime(InRiseTime)
             , InputFallTime(InFallTime)
             , OutputSignal(FAudioBufferWriteRef::CreateNew(InSettings))
-            , PreviousOutputSample(0.0f)
-            , SampleRate(InSettings.GetSampleRate())
+            , Smoother(MetasoundBranches::FSmootherBlockCoefficients(InSettings.GetSampleRate()))
         {
         }
 
@@ -78,26 +81,20 @@ namespace Metasound
             return Metadata;
         }
 
-        virtual FDataReferenceCollection GetInputs() const override
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
         {
             using namespace BoolToAudioNodeNames;
 
-            FDataReferenceCollection InputDataReferences;
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputBool), InputBool);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputRiseTime), InputRiseTime);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputFallTime), InputFallTime);
-
-            return InputDataReferences;
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputBool), InputBool);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputRiseTime), InputRiseTime);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputFallTime), InputFallTime);
         }
 
-        virtual FDataReferenceCollection GetOutputs() const override
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
         {
             using namespace BoolToAudioNodeNames;
 
-            FDataReferenceCollection OutputDataReferences;
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputSignal), OutputSignal);
-
-            return OutputDataReferences;
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputSignal), OutputSignal);
         }
 
         static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
@@ -125,48 +122,28 @@ namespace Metasound
             return MakeUnique<FBoolToAudioOperator>(InParams.OperatorSettings, InputBool, InputRiseTime, InputFallTime);
         }
 
-        virtual void Execute()
+        virtual void Reset(const IOperator::FResetParams& InParams)
         {
-            int32 NumFrames = OutputSignal->Num();
-            float* OutputDataPtr = OutputSignal->GetData();
-
-            float TargetValue = *InputBool ? 1.0f : 0.0f;
-
-            float RiseTimeSeconds = InputRiseTime->GetSeconds();
-            float FallTimeSeconds = InputFallTime->GetSeconds();
+            OutputSignal->Zero();
+            Smoother.Reset();
+        }
 
-            float RiseAlpha = (RiseTimeSeconds > 0.0f) ? FMath::Exp(-1.0f / (RiseTimeSeconds * SampleRate)) : 0.0f;
-            float FallAlpha = (FallTimeSeconds > 0.0f) ? FMath::Exp(-1.0f / (FallTimeSeconds * SampleRate)) : 0.0f;
+        virtual void Execute()
+        {
+            METASOUNDBRANCHES_EXECUTE_SCOPE(FBoolToAudioOperator);
 
-            for (int32 i = 0; i < NumFrames; ++i)
-            {
-                float OutputSample = PreviousOutputSample;
-
-                if (TargetValue > PreviousOutputSample)
-                {
-                    OutputSample = RiseAlpha * PreviousOutputSample + (1.0f - RiseAlpha) * TargetValue;
-                }
-                else if (TargetValue < PreviousOutputSample)
-                {
-                    OutputSample = FallAlpha * PreviousOutputSample + (1.0f - FallAlpha) * TargetValue;
-                }
-                else
-                {
-                    OutputSample = TargetValue;
-                }
-
-                OutputDataPtr[i] = OutputSample;
-                PreviousOutputSample = OutputSample;
-            }
+            Smoother.GetCoefficients().Update(InputRiseTime->GetSeconds(), InputFallTime->GetSeconds());
+            Smoother.Process(MetasoundBranches::FSmootherConstantInput(*InputBool), OutputSignal->GetData(), OutputSignal->Num());
         }
 
     private:
+        METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(FBoolToAudioOperator);
+
         FBoolReadRef InputBool;
         FTimeReadRef InputRiseTime;
         FTimeReadRef InputFallTime;
         FAudioBufferWriteRef OutputSignal;
-        float PreviousOutputSample;
-        float SampleRate;
+        MetasoundBranches::TOnePoleSmoother<MetasoundBranches::FSmootherBlockCoefficients> Smoother;
     };
 
     class FBoolToAudioNode : public FNodeFacade
@@ -1,20 +1,33 @@
 // Copyright 2025 Charles Matthews. All Rights Reserved.
 
 #include "MetasoundBranches/Public/MetasoundBranches.h"
+#include "MetasoundBranches/Private/MetasoundBranchesRealtimeAudit.h"
+#include "MetasoundBranches/Private/MetasoundBranchesKernelDispatch.h"
+#include "MetasoundBranches/Private/MetasoundBranchesWaveChunkPrimer.h"
 #include "MetasoundFrontendRegistries.h"
 #include "Modules/ModuleManager.h"
 #include "MetasoundDataTypeRegistrationMacro.h"
 
 #define LOCTEXT_NAMESPACE "FMetasoundBranchesModule"
 
+DEFINE_LOG_CATEGORY(LogMetasoundBranches);
+
 void FMetasoundBranchesModule::StartupModule()
 {
     using namespace Metasound;
 	FMetasoundFrontendRegistryContainer::Get()->RegisterPendingNodes();
+
+#if METASOUNDBRANCHES_REALTIME_AUDIT
+    MetasoundBranches::RealtimeAudit::Startup();
+#endif
+
+    UE_LOG(LogMetasoundBranches, Log, TEXT("DSP kernels: %s available (au.MetasoundBranches.SimdLevel selects lower levels)."),
+        ANSI_TO_TCHAR(MetasoundBranches::GetSimdLevelName(MetasoundBranches::GetHostSimdLevel())));
 }
 
 void FMetasoundBranchesModule::ShutdownModule()
 {
+    MetasoundBranches::WaveChunkPrimer::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,190 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Private/MetasoundBranchesExecuteHistogram.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
+
+#if METASOUNDBRANCHES_INSTRUMENTATION
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+
+namespace MetasoundBranches
+{
+    namespace ExecuteHistogramPrivate
+    {
+        // Constant-initialised, so it is valid before any histogram registers itself during static init
+        FExecuteHistogram* Head = nullptr;
+
+        std::atomic<int32> NextShard{ 0 };
+
+        double CyclesToMicroseconds(uint64 Cycles)
+        {
+            return FPlatformTime::GetSecondsPerCycle64() * static_cast<double>(Cycles) * 1.0e6;
+        }
+
+        FAutoConsoleCommandWithOutputDevice DumpCommand(
+            TEXT("au.MetasoundBranches.ExecuteTimes.Dump"),
+            TEXT("Lists p50, p99, p99.9 and max Execute() times per MetaSound Branches operator class, slowest first."),
+            FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&FExecuteHistogram::DumpAll));
+
+        FAutoConsoleCommand ResetCommand(
+            TEXT("au.MetasoundBranches.ExecuteTimes.Reset"),
+            TEXT("Clears the MetaSound Branches Execute() time histograms."),
+            FConsoleCommandDelegate::CreateStatic(&FExecuteHistogram::ResetAll));
+    }
+
+    FExecuteHistogram::FExecuteHistogram(const TCHAR* InOperatorName)
+        : OperatorName(InOperatorName)
+        , Next(ExecuteHistogramPrivate::Head)
+    {
+        Reset();
+        ExecuteHistogramPrivate::Head = this;
+    }
+
+    void FExecuteHistogram::Record(uint64 Cycles)
+    {
+        FShard& Shard = Shards[GetThreadShard()];
+
+        Shard.Counts[GetBucketIndex(Cycles)].fetch_add(1, std::memory_order_relaxed);
+
+        uint64 PreviousMax = Shard.MaxCycles.load(std::memory_order_relaxed);
+        while (Cycles > PreviousMax && !Shard.MaxCycles.compare_exchange_weak(PreviousMax, Cycles, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    int32 FExecuteHistogram::GetBucketIndex(uint64 Cycles)
+    {
+        if (Cycles < NumSubBuckets)
+        {
+            return static_cast<int32>(Cycles);
+        }
+
+        // The octave, then the two bits below the leading one
+        const int32 Octave = static_cast<int32>(FMath::FloorLog2_64(Cycles));
+        const int32 SubBucket = static_cast<int32>((Cycles >> (Octave - 2)) & (NumSubBuckets - 1));
+
+        return FMath::Min(Octave * NumSubBuckets + SubBucket, NumBuckets - 1);
+    }
+
+    uint64 FExecuteHistogram::GetBucketLimit(int32 BucketIndex)
+    {
+        // Below 4 cycles each bucket is exact; buckets 4-7 (octave 1) are never written
+        if (BucketIndex < 2 * NumSubBuckets)
+        {
+            return FMath::Min<uint64>(BucketIndex + 1, NumSubBuckets);
+        }
+
+        const int32 Octave = BucketIndex / NumSubBuckets;
+        const int32 SubBucket = BucketIndex % NumSubBuckets;
+
+        return static_cast<uint64>(NumSubBuckets + SubBucket + 1) << (Octave - 2);
+    }
+
+    int32 FExecuteHistogram::GetThreadShard()
+    {
+        static thread_local const int32 Shard = ExecuteHistogramPrivate::NextShard.fetch_add(1, std::memory_order_relaxed) % NumShards;
+        return Shard;
+    }
+
+    void FExecuteHistogram::Reset()
+    {
+        for (FShard& Shard : Shards)
+        {
+            for (std::atomic<uint32>& Count : Shard.Counts)
+            {
+                Count.store(0, std::memory_order_relaxed);
+            }
+            Shard.MaxCycles.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void FExecuteHistogram::ResetAll()
+    {
+        for (FExecuteHistogram* Histogram = ExecuteHistogramPrivate::Head; Histogram; Histogram = Histogram->Next)
+        {
+            Histogram->Reset();
+        }
+    }
+
+    void FExecuteHistogram::DumpAll(FOutputDevice& Ar)
+    {
+        // Slowest worst case first
+        TArray<const FExecuteHistogram*> Histograms;
+        for (const FExecuteHistogram* Histogram = ExecuteHistogramPrivate::Head; Histogram; Histogram = Histogram->Next)
+        {
+            Histograms.Add(Histogram);
+        }
+
+        auto GetMax = [](const FExecuteHistogram* Histogram)
+        {
+            uint64 MaxCycles = 0;
+            for (const FShard& Shard : Histogram->Shards)
+            {
+                MaxCycles = FMath::Max(MaxCycles, Shard.MaxCycles.load(std::memory_order_relaxed));
+            }
+            return MaxCycles;
+        };
+
+        Histograms.Sort([&GetMax](const FExecuteHistogram& A, const FExecuteHistogram& B) { return GetMax(&A) > GetMax(&B); });
+
+        Ar.Logf(TEXT("%-36s %10s %10s %10s %10s %10s"), TEXT("Operator (times in us)"), TEXT("Blocks"), TEXT("p50"), TEXT("p99"), TEXT("p99.9"), TEXT("Max"));
+
+        for (const FExecuteHistogram* Histogram : Histograms)
+        {
+            Histogram->Dump(Ar);
+        }
+    }
+
+    void FExecuteHistogram::Dump(FOutputDevice& Ar) const
+    {
+        uint64 Counts[NumBuckets] = { 0 };
+        uint64 Total = 0;
+        uint64 MaxCycles = 0;
+
+        for (const FShard& Shard : Shards)
+        {
+            for (int32 i = 0; i < NumBuckets; ++i)
+            {
+                const uint32 Count = Shard.Counts[i].load(std::memory_order_relaxed);
+                Counts[i] += Count;
+                Total += Count;
+            }
+            MaxCycles = FMath::Max(MaxCycles, Shard.MaxCycles.load(std::memory_order_relaxed));
+        }
+
+        if (Total == 0)
+        {
+            return;
+        }
+
+        // Upper edge of the bucket holding the given quantile, so percentiles are never understated
+        auto GetPercentile = [&Counts, Total](double Quantile)
+        {
+            const uint64 Rank = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(Quantile * static_cast<double>(Total))));
+            uint64 Cumulative = 0;
+
+            for (int32 i = 0; i < NumBuckets; ++i)
+            {
+                Cumulative += Counts[i];
+                if (Cumulative >= Rank)
+                {
+                    return GetBucketLimit(i);
+                }
+            }
+            return GetBucketLimit(NumBuckets - 1);
+        };
+
+        using ExecuteHistogramPrivate::CyclesToMicroseconds;
+
+        Ar.Logf(TEXT("%-36s %10llu %10.2f %10.2f %10.2f %10.2f"),
+            OperatorName,
+            Total,
+            CyclesToMicroseconds(FMath::Min(GetPercentile(0.5), MaxCycles)),
+            CyclesToMicroseconds(FMath::Min(GetPercentile(0.99), MaxCycles)),
+            CyclesToMicroseconds(FMath::Min(GetPercentile(0.999), MaxCycles)),
+            CyclesToMicroseconds(MaxCycles));
+    }
+}
+
+#endif
@@ -0,0 +1,81 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include <atomic>
+
+namespace MetasoundBranches
+{
+    // Distribution of Execute() durations for one operator class, for finding the nodes behind worst-case
+    // render spikes. Dump with au.MetasoundBranches.ExecuteTimes.Dump, clear with au.MetasoundBranches.ExecuteTimes.Reset.
+    //
+    // Durations go into buckets that split each octave of CPU cycles into four equal steps, so a bucket is
+    // 25% of its lower edge wide at the start of an octave and 14% at the end; percentiles, reported as a
+    // bucket's upper edge, overstate by at most 25%.
+    // Recording is lock-free: each thread writes to one of a few cache-line-aligned shards, chosen on the
+    // thread's first use, so concurrent render threads don't contend. Shards are summed when dumping.
+    class FExecuteHistogram
+    {
+    public:
+        // Instances are static, one per operator class; they link themselves into a global list
+        explicit FExecuteHistogram(const TCHAR* InOperatorName);
+
+        UE_NONCOPYABLE(FExecuteHistogram);
+
+        void Record(uint64 Cycles);
+
+        // Log p50, p99, p99.9 and max for every operator class with recorded blocks
+        static void DumpAll(FOutputDevice& Ar);
+        static void ResetAll();
+
+        static constexpr int32 NumSubBuckets = 4;
+        static constexpr int32 NumOctaves = 48;
+        static constexpr int32 NumBuckets = NumSubBuckets * NumOctaves;
+        static constexpr int32 NumShards = 8;
+
+    private:
+        static int32 GetBucketIndex(uint64 Cycles);
+
+        // Upper edge of a bucket, in cycles
+        static uint64 GetBucketLimit(int32 BucketIndex);
+
+        static int32 GetThreadShard();
+
+        void Dump(FOutputDevice& Ar) const;
+        void Reset();
+
+        struct alignas(PLATFORM_CACHE_LINE_SIZE) FShard
+        {
+            std::atomic<uint32> Counts[NumBuckets];
+            std::atomic<uint64> MaxCycles;
+        };
+
+        const TCHAR* OperatorName;
+        FShard Shards[NumShards];
+        FExecuteHistogram* Next;
+    };
+
+    // Records the lifetime of the scope into a histogram
+    class FExecuteHistogramScope
+    {
+    public:
+        explicit FExecuteHistogramScope(FExecuteHistogram& InHistogram)
+            : Histogram(InHistogram)
+            , StartCycles(FPlatformTime::Cycles64())
+        {
+        }
+
+        ~FExecuteHistogramScope()
+        {
+            Histogram.Record(FPlatformTime::Cycles64() - StartCycles);
+        }
+
+        UE_NONCOPYABLE(FExecuteHistogramScope);
+
+    private:
+        FExecuteHistogram& Histogram;
+        uint64 StartCycles;
+    };
+}
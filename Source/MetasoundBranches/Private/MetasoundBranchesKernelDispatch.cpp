@@ -0,0 +1,32 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Private/MetasoundBranchesKernelDispatch.h"
+#include "HAL/IConsoleManager.h"
+
+namespace MetasoundBranches
+{
+    namespace KernelDispatchPrivate
+    {
+        int32 SimdLevelOverride = -1;
+
+        FAutoConsoleVariableRef CVarSimdLevel(
+            TEXT("au.MetasoundBranches.SimdLevel"),
+            SimdLevelOverride,
+            TEXT("Kernel implementations for MetaSound Branches operators created from now on, capped at what the CPU supports.\n")
+            TEXT("-1: Widest available (default), 0: Scalar reference, 1: SSE/NEON, 2: AVX2, 3: AVX-512"),
+            ECVF_Default);
+    }
+
+    ESimdLevel GetOperatorSimdLevel()
+    {
+        const ESimdLevel HostLevel = GetHostSimdLevel();
+        const int32 Override = KernelDispatchPrivate::SimdLevelOverride;
+
+        if (Override < 0)
+        {
+            return HostLevel;
+        }
+
+        return static_cast<ESimdLevel>(FMath::Min(Override, static_cast<int32>(HostLevel)));
+    }
+}
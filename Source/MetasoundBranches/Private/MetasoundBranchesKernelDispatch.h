@@ -0,0 +1,14 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MetasoundBranches/Private/DSP/SimdDispatch.h"
+
+namespace MetasoundBranches
+{
+    // The kernel implementations for an operator being created: the widest the CPU supports, unless lowered with
+    // au.MetasoundBranches.SimdLevel for A/B comparisons. Operators choose once, at creation, so a change to the
+    // variable applies to sounds started after it.
+    ESimdLevel GetOperatorSimdLevel();
+}
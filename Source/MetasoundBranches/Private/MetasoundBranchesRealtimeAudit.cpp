@@ -0,0 +1,194 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Private/MetasoundBranchesRealtimeAudit.h"
+
+#if METASOUNDBRANCHES_REALTIME_AUDIT
+
+#include "MetasoundBranches/Public/MetasoundBranches.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformStackWalk.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+namespace MetasoundBranches
+{
+    namespace RealtimeAuditPrivate
+    {
+        // The innermost audited scope on this thread, or null outside Execute()
+        thread_local FRealtimeAuditScope* CurrentScope = nullptr;
+
+        std::atomic<uint64> NumViolations{ 0 };
+        bool bIsEnabled = false;
+
+        // Operator classes already reported, so a per-block allocation is logged once rather than every block
+        FCriticalSection ReportedLock;
+        TSet<FString> ReportedOperators;
+
+        FORCEINLINE void Check(const TCHAR* Kind)
+        {
+            if (FRealtimeAuditScope* Scope = CurrentScope)
+            {
+                // Anything the recording itself allocates is not audited
+                CurrentScope = nullptr;
+                Scope->RecordViolation(Kind);
+                CurrentScope = Scope;
+            }
+        }
+
+        // Forwards to the allocator it wraps, checking each call against the current thread's audit scope
+        class FAuditMalloc final : public FMalloc
+        {
+        public:
+            explicit FAuditMalloc(FMalloc* InInner)
+                : Inner(InInner)
+            {
+            }
+
+            virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+            {
+                Check(TEXT("malloc"));
+                return Inner->Malloc(Count, Alignment);
+            }
+
+            virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+            {
+                Check(TEXT("malloc"));
+                return Inner->TryMalloc(Count, Alignment);
+            }
+
+            virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+            {
+                Check(TEXT("realloc"));
+                return Inner->Realloc(Original, Count, Alignment);
+            }
+
+            virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+            {
+                Check(TEXT("realloc"));
+                return Inner->TryRealloc(Original, Count, Alignment);
+            }
+
+            virtual void Free(void* Original) override
+            {
+                if (Original != nullptr)
+                {
+                    Check(TEXT("free"));
+                }
+                Inner->Free(Original);
+            }
+
+            virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+            virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+            virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+            virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+            virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+            virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+            virtual void UpdateStats() override { Inner->UpdateStats(); }
+            virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+            virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+            virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+            virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+            virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+        private:
+            FMalloc* Inner;
+        };
+    }
+
+    namespace RealtimeAudit
+    {
+        void Startup()
+        {
+            if (FParse::Param(FCommandLine::Get(), TEXT("MetasoundBranchesRealtimeAudit")))
+            {
+                Enable();
+            }
+        }
+
+        void Enable()
+        {
+            using namespace RealtimeAuditPrivate;
+
+            if (bIsEnabled)
+            {
+                return;
+            }
+
+            FPlatformStackWalk::InitStackWalking();
+
+            // Never uninstalled: blocks allocated before or after the swap are all freed through the wrapper
+            GMalloc = new FAuditMalloc(GMalloc);
+            bIsEnabled = true;
+
+            UE_LOG(LogMetasoundBranches, Display, TEXT("Real-time audit enabled: allocations inside operator Execute() will be reported."));
+        }
+
+        bool IsEnabled()
+        {
+            return RealtimeAuditPrivate::bIsEnabled;
+        }
+
+        uint64 GetNumViolations()
+        {
+            return RealtimeAuditPrivate::NumViolations.load(std::memory_order_relaxed);
+        }
+    }
+
+    FRealtimeAuditScope::FRealtimeAuditScope(const TCHAR* InOperatorName)
+        : OperatorName(InOperatorName)
+        , OuterScope(RealtimeAuditPrivate::CurrentScope)
+    {
+        RealtimeAuditPrivate::CurrentScope = this;
+    }
+
+    FRealtimeAuditScope::~FRealtimeAuditScope()
+    {
+        using namespace RealtimeAuditPrivate;
+
+        CurrentScope = OuterScope;
+
+        if (NumViolations == 0)
+        {
+            return;
+        }
+
+        RealtimeAuditPrivate::NumViolations.fetch_add(NumViolations, std::memory_order_relaxed);
+
+        {
+            FScopeLock Lock(&ReportedLock);
+
+            bool bAlreadyReported = false;
+            ReportedOperators.Add(OperatorName, &bAlreadyReported);
+
+            if (bAlreadyReported)
+            {
+                return;
+            }
+        }
+
+        FString Report;
+
+        for (uint32 Depth = 0; Depth < CallstackDepth; ++Depth)
+        {
+            ANSICHAR Frame[1024] = { 0 };
+            FPlatformStackWalk::ProgramCounterToHumanReadableString(Depth, Callstack[Depth], Frame, sizeof(Frame));
+            Report += FString::Printf(TEXT("\n    %s"), ANSI_TO_TCHAR(Frame));
+        }
+
+        UE_LOG(LogMetasoundBranches, Error, TEXT("%s::Execute: %s on the audio render thread (%u heap operation(s) this block; further blocks not reported).%s"),
+            OperatorName, FirstViolationKind, NumViolations, *Report);
+    }
+
+    void FRealtimeAuditScope::RecordViolation(const TCHAR* InKind)
+    {
+        if (NumViolations++ == 0)
+        {
+            FirstViolationKind = InKind;
+            CallstackDepth = FPlatformStackWalk::CaptureStackBackTrace(Callstack, MaxCallstackDepth);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,68 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Real-time safety audit: flags heap allocations made from inside an operator's Execute().
+// Compiled into development and debug builds; enabled at runtime with -MetasoundBranchesRealtimeAudit, and by
+// the offline-render tests.
+#ifndef METASOUNDBRANCHES_REALTIME_AUDIT
+#define METASOUNDBRANCHES_REALTIME_AUDIT (!UE_BUILD_SHIPPING && !UE_BUILD_TEST)
+#endif
+
+#if METASOUNDBRANCHES_REALTIME_AUDIT
+
+namespace MetasoundBranches
+{
+    namespace RealtimeAudit
+    {
+        // Installs the auditing allocator if the command line asks for it. Called once at module startup.
+        void Startup();
+
+        // Installs the auditing allocator whatever the command line says, if it isn't already. For tests that
+        // must not pass with an allocating operator. Game thread only.
+        void Enable();
+
+        // True once the auditing allocator is installed
+        bool IsEnabled();
+
+        // Allocations, reallocations and frees seen inside audited scopes since startup
+        uint64 GetNumViolations();
+    }
+
+    // Marks the current thread as running an operator's Execute(). Any malloc, realloc or free made
+    // until the scope ends is reported once per operator class, as an error with a callstack.
+    class FRealtimeAuditScope
+    {
+    public:
+        explicit FRealtimeAuditScope(const TCHAR* InOperatorName);
+        ~FRealtimeAuditScope();
+
+        UE_NONCOPYABLE(FRealtimeAuditScope);
+
+        // Called by the auditing allocator
+        void RecordViolation(const TCHAR* InKind);
+
+    private:
+        static constexpr int32 MaxCallstackDepth = 32;
+
+        const TCHAR* OperatorName;
+        FRealtimeAuditScope* OuterScope;
+
+        // The first violation in this scope, symbolicated when the scope ends
+        const TCHAR* FirstViolationKind = nullptr;
+        uint64 Callstack[MaxCallstackDepth];
+        uint32 CallstackDepth = 0;
+        uint32 NumViolations = 0;
+    };
+}
+
+#define METASOUNDBRANCHES_REALTIME_AUDIT_SCOPE(OperatorName) \
+    MetasoundBranches::FRealtimeAuditScope PREPROCESSOR_JOIN(RealtimeAuditScope_, __LINE__)(TEXT(#OperatorName))
+
+#else
+
+#define METASOUNDBRANCHES_REALTIME_AUDIT_SCOPE(OperatorName)
+
+#endif
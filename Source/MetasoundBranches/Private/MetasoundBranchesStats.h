@@ -0,0 +1,87 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "MetasoundBranches/Private/MetasoundBranchesRealtimeAudit.h"
+#include "MetasoundBranches/Private/MetasoundBranchesExecuteHistogram.h"
+
+// Per-operator instrumentation: a named Insights CPU scope, cycle counter and duration histogram around
+// Execute(), plus a live instance count per operator class, shown with "stat MetasoundBranches". None of
+// it exists in Shipping builds.
+#ifndef METASOUNDBRANCHES_INSTRUMENTATION
+#define METASOUNDBRANCHES_INSTRUMENTATION (!UE_BUILD_SHIPPING)
+#endif
+
+#if METASOUNDBRANCHES_INSTRUMENTATION && STATS
+
+DECLARE_STATS_GROUP(TEXT("MetaSound Branches"), STATGROUP_MetasoundBranches, STATCAT_Advanced);
+
+#define METASOUNDBRANCHES_DECLARE_OPERATOR_CYCLE_STATS(OperatorName) \
+    DECLARE_CYCLE_STAT(TEXT(#OperatorName "::Execute"), STAT_MetasoundBranches_##OperatorName##_Execute, STATGROUP_MetasoundBranches); \
+    DECLARE_DWORD_ACCUMULATOR_STAT(TEXT(#OperatorName " Instances"), STAT_MetasoundBranches_##OperatorName##_Instances, STATGROUP_MetasoundBranches)
+
+// As a member of the operator class; counts live instances
+#define METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(OperatorName) \
+    struct FInstanceCounter \
+    { \
+        FInstanceCounter() { INC_DWORD_STAT(STAT_MetasoundBranches_##OperatorName##_Instances); } \
+        ~FInstanceCounter() { DEC_DWORD_STAT(STAT_MetasoundBranches_##OperatorName##_Instances); } \
+    } InstanceCounter
+
+#define METASOUNDBRANCHES_EXECUTE_CYCLE_COUNTER(OperatorName) \
+    SCOPE_CYCLE_COUNTER(STAT_MetasoundBranches_##OperatorName##_Execute)
+
+#else
+
+#define METASOUNDBRANCHES_DECLARE_OPERATOR_CYCLE_STATS(OperatorName)
+#define METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(OperatorName)
+#define METASOUNDBRANCHES_EXECUTE_CYCLE_COUNTER(OperatorName)
+
+#endif
+
+#if METASOUNDBRANCHES_INSTRUMENTATION
+
+#define METASOUNDBRANCHES_DECLARE_OPERATOR_HISTOGRAM(OperatorName) \
+    static MetasoundBranches::FExecuteHistogram GExecuteHistogram_##OperatorName(TEXT(#OperatorName))
+
+#define METASOUNDBRANCHES_EXECUTE_TRACE_SCOPE(OperatorName) \
+    TRACE_CPUPROFILER_EVENT_SCOPE_STR("MetasoundBranches::" #OperatorName "::Execute")
+
+#define METASOUNDBRANCHES_EXECUTE_HISTOGRAM_SCOPE(OperatorName) \
+    MetasoundBranches::FExecuteHistogramScope PREPROCESSOR_JOIN(ExecuteHistogramScope_, __LINE__)(GExecuteHistogram_##OperatorName)
+
+#else
+
+#define METASOUNDBRANCHES_DECLARE_OPERATOR_HISTOGRAM(OperatorName)
+#define METASOUNDBRANCHES_EXECUTE_TRACE_SCOPE(OperatorName)
+#define METASOUNDBRANCHES_EXECUTE_HISTOGRAM_SCOPE(OperatorName)
+
+#endif
+
+// At file scope in the operator's .cpp
+#define METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(OperatorName) \
+    METASOUNDBRANCHES_DECLARE_OPERATOR_CYCLE_STATS(OperatorName); \
+    METASOUNDBRANCHES_DECLARE_OPERATOR_HISTOGRAM(OperatorName)
+
+// First statement of every operator's Execute(): trace scope, cycle counter, real-time audit and, innermost
+// so it times only the operator's own work, the duration histogram
+#define METASOUNDBRANCHES_EXECUTE_SCOPE(OperatorName) \
+    METASOUNDBRANCHES_EXECUTE_TRACE_SCOPE(OperatorName); \
+    METASOUNDBRANCHES_EXECUTE_CYCLE_COUNTER(OperatorName); \
+    METASOUNDBRANCHES_REALTIME_AUDIT_SCOPE(OperatorName); \
+    METASOUNDBRANCHES_EXECUTE_HISTOGRAM_SCOPE(OperatorName)
+
+// For operator templates, which can't name their own stats: inside the kernel struct the template holds as a
+// member, in place of METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER. The template's Execute() runs its body
+// through KernelType::ExecuteScoped(), which opens METASOUNDBRANCHES_EXECUTE_SCOPE for the named class.
+#define METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(OperatorName) \
+    template<typename FunctionType> \
+    static FORCEINLINE void ExecuteScoped(FunctionType&& Function) \
+    { \
+        METASOUNDBRANCHES_EXECUTE_SCOPE(OperatorName); \
+        Function(); \
+    } \
+    METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(OperatorName)
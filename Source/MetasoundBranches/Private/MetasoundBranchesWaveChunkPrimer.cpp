@@ -0,0 +1,191 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Private/MetasoundBranchesWaveChunkPrimer.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+namespace MetasoundBranches
+{
+    FWaveChunkPrimeChannel::FWaveChunkPrimeChannel(uint32 InNumChunksPerWave)
+        : Queue(QueueSize)
+        , NumChunksPerWave(InNumChunksPerWave)
+    {
+        Handles.Reserve(MaxWavesPerSet * NumChunksPerWave);
+    }
+
+    bool FWaveChunkPrimeChannel::Post(TArrayView<const Metasound::FWaveAsset> Waves)
+    {
+        int32 NumWaves = 0;
+        for (const Metasound::FWaveAsset& Wave : Waves)
+        {
+            NumWaves += Wave.IsSoundWaveValid() ? 1 : 0;
+        }
+        NumWaves = FMath::Min(NumWaves, MaxWavesPerSet);
+
+        // The whole set and its marker, or nothing. Seen from this side, Count() can only overestimate.
+        if (Queue.Count() + NumWaves + 1 > QueueSize - 1)
+        {
+            return false;
+        }
+
+        Queue.Enqueue(FRequest());
+
+        for (const Metasound::FWaveAsset& Wave : Waves)
+        {
+            if (NumWaves == 0)
+            {
+                break;
+            }
+
+            if (Wave.IsSoundWaveValid())
+            {
+                Queue.Enqueue(FRequest{ Wave.GetSoundWaveProxy() });
+                --NumWaves;
+            }
+        }
+
+        return true;
+    }
+
+    void FWaveChunkPrimeChannel::Service()
+    {
+        FRequest Request;
+
+        while (Queue.Dequeue(Request))
+        {
+            if (!Request.Proxy.IsValid())
+            {
+                Handles.Reset();
+            }
+            else if (Request.Proxy->IsStreaming())
+            {
+                const uint32 NumChunks = FMath::Min(Request.Proxy->GetNumChunks(), NumChunksPerWave);
+                for (uint32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+                {
+                    Handles.Add(FSoundWaveProxy::GetAudioChunk(Request.Proxy, ChunkIndex));
+                }
+            }
+        }
+    }
+
+    namespace WaveChunkPrimerPrivate
+    {
+        // How often the thread looks for new sets while any channel exists
+        constexpr uint32 PollIntervalMs = 5;
+
+        class FPrimerThread final : public FRunnable
+        {
+        public:
+            FPrimerThread()
+                : WakeEvent(FPlatformProcess::GetSynchEventFromPool())
+            {
+                Thread = FRunnableThread::Create(this, TEXT("MetasoundBranchesWaveChunkPrimer"), 0, TPri_BelowNormal);
+            }
+
+            virtual ~FPrimerThread() override
+            {
+                if (Thread != nullptr)
+                {
+                    Stop();
+                    Thread->WaitForCompletion();
+                    delete Thread;
+                }
+
+                FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+            }
+
+            void Add(TSharedRef<FWaveChunkPrimeChannel> Channel)
+            {
+                {
+                    FScopeLock Lock(&NewChannelsLock);
+                    NewChannels.Add(MoveTemp(Channel));
+                }
+
+                WakeEvent->Trigger();
+            }
+
+            virtual uint32 Run() override
+            {
+                while (!bStopping)
+                {
+                    {
+                        FScopeLock Lock(&NewChannelsLock);
+                        Channels.Append(MoveTemp(NewChannels));
+                        NewChannels.Reset();
+                    }
+
+                    for (int32 Index = Channels.Num() - 1; Index >= 0; --Index)
+                    {
+                        Channels[Index]->Service();
+
+                        // Only this thread still holds it, so its operator has gone: release its chunks here
+                        if (Channels[Index].GetSharedReferenceCount() == 1)
+                        {
+                            Channels.RemoveAtSwap(Index);
+                        }
+                    }
+
+                    WakeEvent->Wait(Channels.IsEmpty() ? MAX_uint32 : PollIntervalMs);
+                }
+
+                Channels.Reset();
+                return 0;
+            }
+
+            virtual void Stop() override
+            {
+                bStopping = true;
+                WakeEvent->Trigger();
+            }
+
+        private:
+            FRunnableThread* Thread = nullptr;
+            FEvent* WakeEvent;
+            std::atomic<bool> bStopping{ false };
+
+            // Channels created since the thread last looked
+            FCriticalSection NewChannelsLock;
+            TArray<TSharedRef<FWaveChunkPrimeChannel>> NewChannels;
+
+            // Primer thread only
+            TArray<TSharedRef<FWaveChunkPrimeChannel>> Channels;
+        };
+
+        FCriticalSection PrimerLock;
+        TUniquePtr<FPrimerThread> Primer;
+    }
+
+    TSharedPtr<FWaveChunkPrimeChannel> WaveChunkPrimer::CreateChannel(uint32 NumChunksPerWave)
+    {
+        using namespace WaveChunkPrimerPrivate;
+
+        if (!FPlatformProcess::SupportsMultithreading())
+        {
+            return nullptr;
+        }
+
+        TSharedRef<FWaveChunkPrimeChannel> Channel = MakeShared<FWaveChunkPrimeChannel>(NumChunksPerWave);
+
+        FScopeLock Lock(&PrimerLock);
+
+        if (!Primer.IsValid())
+        {
+            Primer = MakeUnique<FPrimerThread>();
+        }
+
+        Primer->Add(Channel);
+        return Channel;
+    }
+
+    void WaveChunkPrimer::Shutdown()
+    {
+        using namespace WaveChunkPrimerPrivate;
+
+        FScopeLock Lock(&PrimerLock);
+        Primer.Reset();
+    }
+}
@@ -0,0 +1,59 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/CircularQueue.h"
+#include "MetasoundWave.h"
+#include "Sound/SoundWave.h"
+
+namespace MetasoundBranches
+{
+    // One operator's line to the wave chunk primer. From the audio render thread the operator posts the set of
+    // waves it wants resident; the primer's background thread requests their first stream chunks and holds them
+    // until the next set replaces them. Posting copies proxy pointers into a fixed-size lock-free queue, so the
+    // render thread never allocates, frees or waits, and chunk handles and proxy references are only released
+    // on the primer thread.
+    class FWaveChunkPrimeChannel
+    {
+    public:
+        // Waves beyond this many in a set are not primed
+        static constexpr int32 MaxWavesPerSet = 64;
+
+        explicit FWaveChunkPrimeChannel(uint32 InNumChunksPerWave);
+
+        // Audio render thread. Replaces the primed set with these waves, or releases it for an empty view.
+        // Returns false, posting nothing, while the primer is still taking earlier sets; post again next block.
+        bool Post(TArrayView<const Metasound::FWaveAsset> Waves);
+
+        // Primer thread: load the chunks of everything posted so far
+        void Service();
+
+    private:
+        // A wave to prime; a null proxy starts a new set, releasing the previous one
+        struct FRequest
+        {
+            FSoundWaveProxyPtr Proxy;
+        };
+
+        // Room for three full sets; a power of two, as TCircularQueue requires
+        static constexpr uint32 QueueSize = 256;
+
+        TCircularQueue<FRequest> Queue;
+        uint32 NumChunksPerWave;
+
+        // The current set's chunks. Primer thread only.
+        TArray<FAudioChunkHandle> Handles;
+    };
+
+    // The background thread behind every FWaveChunkPrimeChannel, started with the first one
+    namespace WaveChunkPrimer
+    {
+        // A channel serviced by the primer thread, or null where the platform has no threads to run it on. Not
+        // real-time safe; call when building operators. The primer releases the channel once the caller has.
+        TSharedPtr<FWaveChunkPrimeChannel> CreateChannel(uint32 NumChunksPerWave);
+
+        // Stops the thread, releasing every primed chunk. Called at module shutdown.
+        void Shutdown();
+    }
+}
@@ -1,6 +1,7 @@
 // Copyright 2025 Charles Matthews. All Rights Reserved.
 
 #include "MetasoundBranches/Public/MetasoundClockDividerNode.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
 #include "MetasoundExecutableOperator.h"     // TExecutableOperator class
 #include "MetasoundPrimitives.h"             // ReadRef and WriteRef descriptions for bool, int32, float, and string
 #include "MetasoundNodeRegistrationMacro.h"  // METASOUND_LOCTEXT and METASOUND_REGISTER_NODE macros
@@ -9,6 +10,8 @@
 
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodes_ClockDividerNode"
 
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FClockDividerOperator);
+
 namespace Metasound
 {
     namespace ClockDividerNodeNames
@@ -97,34 +100,26 @@ namespace Metasound
             return Metadata;
         }
 
-        virtual FDataReferenceCollection GetInputs() const override
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
         {
             using namespace ClockDividerNodeNames;
 
-            FDataReferenceCollection InputDataReferences;
-
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputTrigger), InputTrigger);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputReset), InputReset);
-
-            return InputDataReferences;
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputTrigger), InputTrigger);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputReset), InputReset);
         }
 
-        virtual FDataReferenceCollection GetOutputs() const override
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
         {
             using namespace ClockDividerNodeNames;
 
-            FDataReferenceCollection OutputDataReferences;
-
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputTrigger1), OutputTrigger1);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputTrigger2), OutputTrigger2);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputTrigger3), OutputTrigger3);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputTrigger4), OutputTrigger4);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputTrigger5), OutputTrigger5);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputTrigger6), OutputTrigger6);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputTrigger7), OutputTrigger7);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputTrigger8), OutputTrigger8);
-
-            return OutputDataReferences;
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputTrigger1), OutputTrigger1);
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputTrigger2), OutputTrigger2);
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputTrigger3), OutputTrigger3);
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputTrigger4), OutputTrigger4);
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputTrigger5), OutputTrigger5);
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputTrigger6), OutputTrigger6);
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputTrigger7), OutputTrigger7);
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputTrigger8), OutputTrigger8);
         }
 
         static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
@@ -144,8 +139,24 @@ namespace Metasound
             );
         }
 
+        virtual void Reset(const IOperator::FResetParams& InParams)
+        {
+            OutputTrigger1->Reset();
+            OutputTrigger2->Reset();
+            OutputTrigger3->Reset();
+            OutputTrigger4->Reset();
+            OutputTrigger5->Reset();
+            OutputTrigger6->Reset();
+            OutputTrigger7->Reset();
+            OutputTrigger8->Reset();
+
+            Counter = 0;
+        }
+
         void Execute()
         {
+            METASOUNDBRANCHES_EXECUTE_SCOPE(FClockDividerOperator);
+
             // Handle reset
             InputReset->ExecuteBlock(
                 // Pre-trigger lambda
@@ -238,6 +249,8 @@ namespace Metasound
         }
 
     private:
+        METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(FClockDividerOperator);
+
         FTriggerReadRef InputTrigger;
         FTriggerReadRef InputReset;
 
@@ -0,0 +1,184 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Public/MetasoundCrossfadeStereoAudioRateNode.h"
+#include "MetasoundBranches/Private/MetasoundStereoMatrixOperator.h"
+#include "MetasoundBranches/Private/DSP/StereoModulation.h"
+#include "MetasoundNodeRegistrationMacro.h"  // METASOUND_LOCTEXT and METASOUND_REGISTER_NODE macros
+#include "MetasoundFacade.h"                 // FNodeFacade class, eliminates the need for a fair amount of boilerplate code
+#include "MetasoundParamHelper.h"            // METASOUND_PARAM and METASOUND_GET_PARAM family of macros
+
+#define LOCTEXT_NAMESPACE "MetasoundCrossfadeStereoAudioRateNode"
+
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FCrossfadeStereoAudioRateOperator);
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FCrossfadeStereoAudioRateStereoAudioOperator);
+
+namespace Metasound
+{
+    namespace CrossfadeStereoAudioRateNodeNames
+    {
+        METASOUND_PARAM(InputLeftSignal1, "In1 L", "Left channel of first input.");
+        METASOUND_PARAM(InputRightSignal1, "In1 R", "Right channel of first input.");
+        METASOUND_PARAM(InputLeftSignal2, "In2 L", "Left channel of second input.");
+        METASOUND_PARAM(InputRightSignal2, "In2 R", "Right channel of second input.");
+        METASOUND_PARAM(InputCrossfade, "Crossfade", "Crossfade position between the two inputs (0.0 to 1.0), read per sample.");
+
+        METASOUND_PARAM(OutputLeftSignal, "Out L", "Left channel of the output signal.");
+        METASOUND_PARAM(OutputRightSignal, "Out R", "Right channel of the output signal.");
+
+        METASOUND_PARAM(InputStereoSignal1, "In1", "First stereo input.");
+        METASOUND_PARAM(InputStereoSignal2, "In2", "Second stereo input.");
+        METASOUND_PARAM(OutputStereoSignal, "Out", "Stereo output.");
+    }
+
+    // The control inputs and the matrix they make, shared by the node's two overloads
+    struct FCrossfadeStereoAudioRateControls
+    {
+        using FMatrix = MetasoundBranches::FStereoCrossfadeSignal;
+
+        explicit FCrossfadeStereoAudioRateControls(const FBuildOperatorParams& InParams)
+            : InputCrossfade(InParams.InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(CrossfadeStereoAudioRateNodeNames::InputCrossfade), InParams.OperatorSettings))
+        {
+        }
+
+        void BindInputs(FInputVertexInterfaceData& InVertexData)
+        {
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(CrossfadeStereoAudioRateNodeNames::InputCrossfade), InputCrossfade);
+        }
+
+        FMatrix GetMatrix() const
+        {
+            return FMatrix{ InputCrossfade->GetData() };
+        }
+
+        FAudioBufferReadRef InputCrossfade;
+    };
+
+    struct FCrossfadeStereoAudioRateKernel : FCrossfadeStereoAudioRateControls
+    {
+        using FCrossfadeStereoAudioRateControls::FCrossfadeStereoAudioRateControls;
+
+        static const FVertexInterface& DeclareVertexInterface()
+        {
+            using namespace CrossfadeStereoAudioRateNodeNames;
+
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputLeftSignal1)),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputRightSignal1)),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputLeftSignal2)),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputRightSignal2)),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputCrossfade))
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputLeftSignal)),
+                    TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputRightSignal))
+                )
+            );
+
+            return Interface;
+        }
+
+        static FNodeClassMetadata CreateNodeClassMetadata()
+        {
+            FNodeClassMetadata Metadata;
+
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Crossfade (Audio Rate)"), TEXT("Audio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("CrossfadeStereoAudioRateNodeDisplayName", "Stereo Crossfade (Audio Rate)");
+            Metadata.Description = METASOUND_LOCTEXT("CrossfadeStereoAudioRateNodeDesc", "Crossfades between two stereo signals from a position signal, sample by sample.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
+
+            return Metadata;
+        }
+
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
+        {
+            using namespace CrossfadeStereoAudioRateNodeNames;
+
+            return {
+                {
+                    METASOUND_GET_PARAM_NAME(InputLeftSignal1), METASOUND_GET_PARAM_NAME(InputRightSignal1),
+                    METASOUND_GET_PARAM_NAME(InputLeftSignal2), METASOUND_GET_PARAM_NAME(InputRightSignal2)
+                },
+                { METASOUND_GET_PARAM_NAME(OutputLeftSignal), METASOUND_GET_PARAM_NAME(OutputRightSignal) }
+            };
+        }
+
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FCrossfadeStereoAudioRateOperator);
+    };
+
+    // The StereoAudio overload: the same node with one audio vertex per stereo pair
+    struct FCrossfadeStereoAudioRateStereoAudioKernel : FCrossfadeStereoAudioRateControls
+    {
+        using FCrossfadeStereoAudioRateControls::FCrossfadeStereoAudioRateControls;
+
+        static const FVertexInterface& DeclareVertexInterface()
+        {
+            using namespace CrossfadeStereoAudioRateNodeNames;
+
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputStereoSignal1)),
+                    TInputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputStereoSignal2)),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputCrossfade))
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputStereoSignal))
+                )
+            );
+
+            return Interface;
+        }
+
+        static FNodeClassMetadata CreateNodeClassMetadata()
+        {
+            FNodeClassMetadata Metadata;
+
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Crossfade (Audio Rate)"), TEXT("StereoAudio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("CrossfadeStereoAudioRateStereoAudioNodeDisplayName", "Stereo Crossfade (Audio Rate, Stereo Audio)");
+            Metadata.Description = METASOUND_LOCTEXT("CrossfadeStereoAudioRateStereoAudioNodeDesc", "Crossfades between two stereo signals from a position signal, sample by sample.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
+
+            return Metadata;
+        }
+
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
+        {
+            using namespace CrossfadeStereoAudioRateNodeNames;
+
+            return { { METASOUND_GET_PARAM_NAME(InputStereoSignal1), METASOUND_GET_PARAM_NAME(InputStereoSignal2) }, { METASOUND_GET_PARAM_NAME(OutputStereoSignal) } };
+        }
+
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FCrossfadeStereoAudioRateStereoAudioOperator);
+    };
+
+    using FCrossfadeStereoAudioRateOperator = TStereoMatrixOperator<FCrossfadeStereoAudioRateKernel>;
+    using FCrossfadeStereoAudioRateStereoAudioOperator = TStereoMatrixOperator<FCrossfadeStereoAudioRateStereoAudioKernel, TStereoMatrixStereoVertices<FCrossfadeStereoAudioRateStereoAudioKernel::FMatrix::NumInputs>>;
+
+    class FCrossfadeStereoAudioRateNode : public FNodeFacade
+    {
+    public:
+        FCrossfadeStereoAudioRateNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FCrossfadeStereoAudioRateOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FCrossfadeStereoAudioRateNode);
+
+    class FCrossfadeStereoAudioRateStereoAudioNode : public FNodeFacade
+    {
+    public:
+        FCrossfadeStereoAudioRateStereoAudioNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FCrossfadeStereoAudioRateStereoAudioOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FCrossfadeStereoAudioRateStereoAudioNode);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -1,14 +1,16 @@
 // Copyright 2025 Charles Matthews. All Rights Reserved.
 
 #include "MetasoundBranches/Public/MetasoundCrossfadeStereoNode.h"
-#include "MetasoundExecutableOperator.h"     // TExecutableOperator class
-#include "MetasoundPrimitives.h"             // ReadRef and WriteRef descriptions for bool, int32, float, and string
+#include "MetasoundBranches/Private/MetasoundStereoMatrixOperator.h"
 #include "MetasoundNodeRegistrationMacro.h"  // METASOUND_LOCTEXT and METASOUND_REGISTER_NODE macros
 #include "MetasoundFacade.h"                 // FNodeFacade class, eliminates the need for a fair amount of boilerplate code
 #include "MetasoundParamHelper.h"            // METASOUND_PARAM and METASOUND_GET_PARAM family of macros
 
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodes_CrossfadeStereoNode"
 
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FCrossfadeStereoOperator);
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FCrossfadeStereoStereoAudioOperator);
+
 namespace Metasound
 {
     namespace CrossfadeStereoNodeNames
@@ -21,28 +23,39 @@ namespace Metasound
 
         METASOUND_PARAM(OutputLeftSignal, "Out L", "Left channel of the output signal.");
         METASOUND_PARAM(OutputRightSignal, "Out R", "Right channel of the output signal.");
+
+        METASOUND_PARAM(InputStereoSignal1, "In1", "First stereo input.");
+        METASOUND_PARAM(InputStereoSignal2, "In2", "Second stereo input.");
+        METASOUND_PARAM(OutputStereoSignal, "Out", "Stereo output.");
     }
 
-    class FCrossfadeStereoOperator : public TExecutableOperator<FCrossfadeStereoOperator>
+    // The control inputs and the matrix they make, shared by the node's two overloads
+    struct FCrossfadeStereoControls
     {
-    public:
-        FCrossfadeStereoOperator(
-            const FOperatorSettings& InSettings,
-            const FAudioBufferReadRef& InLeftSignal1,
-            const FAudioBufferReadRef& InRightSignal1,
-            const FAudioBufferReadRef& InLeftSignal2,
-            const FAudioBufferReadRef& InRightSignal2,
-            const FFloatReadRef& InCrossfade)
-            : InputLeftSignal1(InLeftSignal1)
-            , InputRightSignal1(InRightSignal1)
-            , InputLeftSignal2(InLeftSignal2)
-            , InputRightSignal2(InRightSignal2)
-            , InputCrossfade(InCrossfade)
-            , OutputLeftSignal(FAudioBufferWriteRef::CreateNew(InSettings))
-            , OutputRightSignal(FAudioBufferWriteRef::CreateNew(InSettings))
+        using FMatrix = MetasoundBranches::FStereoCrossfade;
+
+        explicit FCrossfadeStereoControls(const FBuildOperatorParams& InParams)
+            : InputCrossfade(InParams.InputData.GetOrCreateDefaultDataReadReference<float>(METASOUND_GET_PARAM_NAME(CrossfadeStereoNodeNames::InputCrossfade), InParams.OperatorSettings))
+        {
+        }
+
+        void BindInputs(FInputVertexInterfaceData& InVertexData)
         {
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(CrossfadeStereoNodeNames::InputCrossfade), InputCrossfade);
         }
 
+        FMatrix GetMatrix() const
+        {
+            return FMatrix::Position(*InputCrossfade);
+        }
+
+        FFloatReadRef InputCrossfade;
+    };
+
+    struct FCrossfadeStereoKernel : FCrossfadeStereoControls
+    {
+        using FCrossfadeStereoControls::FCrossfadeStereoControls;
+
         static const FVertexInterface& DeclareVertexInterface()
         {
             using namespace CrossfadeStereoNodeNames;
@@ -64,113 +77,86 @@ namespace Metasound
             return Interface;
         }
 
-        static const FNodeClassMetadata& GetNodeInfo()
+        static FNodeClassMetadata CreateNodeClassMetadata()
         {
-            auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
-                {
-                    FVertexInterface NodeInterface = DeclareVertexInterface();
-
-                    FNodeClassMetadata Metadata;
+            FNodeClassMetadata Metadata;
 
-                    Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Crossfade"), TEXT("Audio") };
-                    Metadata.MajorVersion = 1;
-                    Metadata.MinorVersion = 0;
-                    Metadata.DisplayName = METASOUND_LOCTEXT("CrossfadeStereoNodeDisplayName", "Stereo Crossfade");
-                    Metadata.Description = METASOUND_LOCTEXT("CrossfadeStereoNodeDesc", "Crossfades between two stereo signals.");
-                    Metadata.Author = "Charles Matthews";
-                    Metadata.PromptIfMissing = PluginNodeMissingPrompt;
-                    Metadata.DefaultInterface = DeclareVertexInterface();
-                    Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
-                    Metadata.Keywords = TArray<FText>(); // Keywords for searching
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Crossfade"), TEXT("Audio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("CrossfadeStereoNodeDisplayName", "Stereo Crossfade");
+            Metadata.Description = METASOUND_LOCTEXT("CrossfadeStereoNodeDesc", "Crossfades between two stereo signals.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
 
-                    return Metadata;
-                };
-
-            static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
             return Metadata;
         }
 
-        virtual FDataReferenceCollection GetInputs() const override
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
         {
             using namespace CrossfadeStereoNodeNames;
 
-            FDataReferenceCollection InputDataReferences;
+            return {
+                {
+                    METASOUND_GET_PARAM_NAME(InputLeftSignal1), METASOUND_GET_PARAM_NAME(InputRightSignal1),
+                    METASOUND_GET_PARAM_NAME(InputLeftSignal2), METASOUND_GET_PARAM_NAME(InputRightSignal2)
+                },
+                { METASOUND_GET_PARAM_NAME(OutputLeftSignal), METASOUND_GET_PARAM_NAME(OutputRightSignal) }
+            };
+        }
 
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputLeftSignal1), InputLeftSignal1);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputRightSignal1), InputRightSignal1);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputLeftSignal2), InputLeftSignal2);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputRightSignal2), InputRightSignal2);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputCrossfade), InputCrossfade);
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FCrossfadeStereoOperator);
+    };
 
-            return InputDataReferences;
-        }
+    // The StereoAudio overload: the same node with one audio vertex per stereo pair
+    struct FCrossfadeStereoStereoAudioKernel : FCrossfadeStereoControls
+    {
+        using FCrossfadeStereoControls::FCrossfadeStereoControls;
 
-        virtual FDataReferenceCollection GetOutputs() const override
+        static const FVertexInterface& DeclareVertexInterface()
         {
             using namespace CrossfadeStereoNodeNames;
 
-            FDataReferenceCollection OutputDataReferences;
-
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputLeftSignal), OutputLeftSignal);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputRightSignal), OutputRightSignal);
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputStereoSignal1)),
+                    TInputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputStereoSignal2)),
+                    TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputCrossfade), 0.5f)
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputStereoSignal))
+                )
+            );
 
-            return OutputDataReferences;
+            return Interface;
         }
 
-        static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+        static FNodeClassMetadata CreateNodeClassMetadata()
         {
-            using namespace CrossfadeStereoNodeNames;
-
-            const FInputVertexInterfaceData& InputData = InParams.InputData;
-            const Metasound::FInputVertexInterface& InputInterface = DeclareVertexInterface().GetInputInterface();
+            FNodeClassMetadata Metadata;
 
-            TDataReadReference<FAudioBuffer> InputLeftSignal1 = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputLeftSignal1), InParams.OperatorSettings);
-            TDataReadReference<FAudioBuffer> InputRightSignal1 = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputRightSignal1), InParams.OperatorSettings);
-            TDataReadReference<FAudioBuffer> InputLeftSignal2 = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputLeftSignal2), InParams.OperatorSettings);
-            TDataReadReference<FAudioBuffer> InputRightSignal2 = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputRightSignal2), InParams.OperatorSettings);
-            TDataReadReference<float> InputCrossfade = InputData.GetOrCreateDefaultDataReadReference<float>(METASOUND_GET_PARAM_NAME(InputCrossfade), InParams.OperatorSettings);
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Crossfade"), TEXT("StereoAudio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("CrossfadeStereoStereoAudioNodeDisplayName", "Stereo Crossfade (Stereo Audio)");
+            Metadata.Description = METASOUND_LOCTEXT("CrossfadeStereoStereoAudioNodeDesc", "Crossfades between two stereo signals.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
 
-            return MakeUnique<FCrossfadeStereoOperator>(InParams.OperatorSettings, InputLeftSignal1, InputRightSignal1, InputLeftSignal2, InputRightSignal2, InputCrossfade);
+            return Metadata;
         }
 
-        void Execute()
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
         {
-            int32 NumFrames = InputLeftSignal1->Num();
-
-            const float* LeftData1 = InputLeftSignal1->GetData();
-            const float* RightData1 = InputRightSignal1->GetData();
-            const float* LeftData2 = InputLeftSignal2->GetData();
-            const float* RightData2 = InputRightSignal2->GetData();
-
-            float* OutputLeftData = OutputLeftSignal->GetData();
-            float* OutputRightData = OutputRightSignal->GetData();
-
-            float CrossfadeFactor = FMath::Clamp(*InputCrossfade, 0.0f, 1.0f);
-
-            float Gain1 = FMath::Cos(CrossfadeFactor * HALF_PI); // HALF_PI = PI / 2
-            float Gain2 = FMath::Sin(CrossfadeFactor * HALF_PI);
+            using namespace CrossfadeStereoNodeNames;
 
-            for (int32 i = 0; i < NumFrames; ++i)
-            {
-                OutputLeftData[i] = Gain1 * LeftData1[i] + Gain2 * LeftData2[i];
-                OutputRightData[i] = Gain1 * RightData1[i] + Gain2 * RightData2[i];
-            }
+            return { { METASOUND_GET_PARAM_NAME(InputStereoSignal1), METASOUND_GET_PARAM_NAME(InputStereoSignal2) }, { METASOUND_GET_PARAM_NAME(OutputStereoSignal) } };
         }
 
-    private:
-
-        // Inputs
-        FAudioBufferReadRef InputLeftSignal1;
-        FAudioBufferReadRef InputRightSignal1;
-        FAudioBufferReadRef InputLeftSignal2;
-        FAudioBufferReadRef InputRightSignal2;
-        FFloatReadRef InputCrossfade;
-
-        // Outputs
-        FAudioBufferWriteRef OutputLeftSignal;
-        FAudioBufferWriteRef OutputRightSignal;
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FCrossfadeStereoStereoAudioOperator);
     };
 
+    using FCrossfadeStereoOperator = TStereoMatrixOperator<FCrossfadeStereoKernel>;
+    using FCrossfadeStereoStereoAudioOperator = TStereoMatrixOperator<FCrossfadeStereoStereoAudioKernel, TStereoMatrixStereoVertices<FCrossfadeStereoStereoAudioKernel::FMatrix::NumInputs>>;
+
     class FCrossfadeStereoNode : public FNodeFacade
     {
     public:
@@ -181,6 +167,17 @@ namespace Metasound
     };
 
     METASOUND_REGISTER_NODE(FCrossfadeStereoNode);
+
+    class FCrossfadeStereoStereoAudioNode : public FNodeFacade
+    {
+    public:
+        FCrossfadeStereoStereoAudioNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FCrossfadeStereoStereoAudioOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FCrossfadeStereoStereoAudioNode);
 }
 
-#undef LOCTEXT_NAMESPACE
\ No newline at end of file
+#undef LOCTEXT_NAMESPACE
@@ -1,25 +1,32 @@
 // Copyright 2025 Charles Matthews. All Rights Reserved.
 
 #include "MetasoundBranches/Public/MetasoundDustNode.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
+#include "MetasoundBranches/Private/DSP/PoissonScheduler.h"
 #include "MetasoundExecutableOperator.h"     // TExecutableOperator class
 #include "MetasoundPrimitives.h"             // ReadRef and WriteRef descriptions for bool, int32, float, and string
 #include "MetasoundNodeRegistrationMacro.h"  // METASOUND_LOCTEXT and METASOUND_REGISTER_NODE macros
 #include "MetasoundFacade.h"                 // FNodeFacade class, eliminates the need for a fair amount of boilerplate code
 #include "MetasoundParamHelper.h"            // METASOUND_PARAM and METASOUND_GET_PARAM family of macros
 #include "Math/UnrealMathUtility.h"          // For FMath functions
+#include "Math/RandomStream.h"               // For FRandomStream, used by the version 1 node
 #include "Misc/DateTime.h"                   // For FDateTime::UtcNow()
 
 // Required for ensuring the node is supported by all languages in engine. Must be unique per MetaSound.
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodes_DustNode"
 
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FDustOperator);
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FDustOperatorV1);
+
 namespace Metasound
 {
     // Vertex Names - define the node's inputs and outputs here
     namespace DustNodeNames
     {
-        METASOUND_PARAM(InputDensity, "Modulation", "Density control signal.");
-        METASOUND_PARAM(InputDensityOffset, "Density", "Probability of impulse generation.");
+        METASOUND_PARAM(InputDensity, "Modulation", "Density control signal, in Hz (its absolute value is added to Density).");
+        METASOUND_PARAM(InputDensityOffset, "Density", "Average number of impulses per second (Hz).");
         METASOUND_PARAM(InputEnabled, "Enabled", "Enable or disable generation.");
+        METASOUND_PARAM(InputSeed, "Seed", "Random seed. The same seed always gives the same events; 0 picks a new seed each time the node is created.");
         METASOUND_PARAM(InputBiPolar, "Bi-Polar", "Toggle between bipolar and unipolar impulse output.");
         METASOUND_PARAM(OutputImpulse, "Impulse Out", "Generated impulse output.");
     }
@@ -34,15 +41,18 @@ namespace Metasound
             const FAudioBufferReadRef& InDensity,
             const FFloatReadRef& InDensityOffset,
             const FBoolReadRef& InEnabled,
+            const FInt32ReadRef& InSeed,
             const FBoolReadRef& InBiPolar)
             : InputDensity(InDensity)
             , InputDensityOffset(InDensityOffset)
             , InputEnabled(InEnabled)
+            , InputSeed(InSeed)
             , InputBiPolar(InBiPolar)
             , OutputImpulse(FAudioBufferWriteRef::CreateNew(InSettings))
-            , RNGStream(InitialSeed())
             , SignalIsPositive(true)
         {
+            CurrentSeed = *InputSeed;
+            Scheduler.Init(InSettings.GetSampleRate(), ResolveSeed(CurrentSeed));
         }
 
         // Helper function for constructing vertex interface
@@ -54,8 +64,9 @@ namespace Metasound
                 FInputVertexInterface(
                     TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputEnabled), true),
                     TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputBiPolar), true),
-                    TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDensityOffset), 0.1f),
-                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDensity))
+                    TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDensityOffset), 5.0f),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDensity)),
+                    TInputDataVertex<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputSeed), 0)
                 ),
                 FOutputVertexInterface(
                     TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputImpulse))
@@ -75,7 +86,7 @@ namespace Metasound
                     FNodeClassMetadata Metadata;
 
                     Metadata.ClassName = { TEXT("UE"), TEXT("Dust (Audio)"), TEXT("Audio") };
-                    Metadata.MajorVersion = 1;
+                    Metadata.MajorVersion = 2;
                     Metadata.MinorVersion = 0;
                     Metadata.DisplayName = METASOUND_LOCTEXT("DustNodeDisplayName", "Dust (Audio)");
                     Metadata.Description = METASOUND_LOCTEXT("DustNodeDesc", "Generate randomly timed impulses with audio-rate modulation.");
@@ -93,27 +104,22 @@ namespace Metasound
         }
 
         // Allows MetaSound graph to interact with the node's inputs
-        virtual FDataReferenceCollection GetInputs() const override
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
         {
             using namespace DustNodeNames;
-            FDataReferenceCollection Inputs;
-            Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputDensity), InputDensity);
-            Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputDensityOffset), InputDensityOffset);
-            Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputEnabled), InputEnabled);
-            Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputBiPolar), InputBiPolar);
-            return Inputs;
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputDensity), InputDensity);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputDensityOffset), InputDensityOffset);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputEnabled), InputEnabled);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputSeed), InputSeed);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputBiPolar), InputBiPolar);
         }
 
         // Allows MetaSound graph to interact with the node's outputs
-        virtual FDataReferenceCollection GetOutputs() const override
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
         {
             using namespace DustNodeNames;
 
-            FDataReferenceCollection OutputDataReferences;
-
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputImpulse), OutputImpulse);
-
-            return OutputDataReferences;
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputImpulse), OutputImpulse);
         }
 
         // Used to instantiate a new runtime instance of the node
@@ -127,41 +133,248 @@ namespace Metasound
             TDataReadReference<FAudioBuffer> InputDensity = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputDensity), InParams.OperatorSettings);
             TDataReadReference<float> InputDensityOffset = InputData.GetOrCreateDefaultDataReadReference<float>(METASOUND_GET_PARAM_NAME(InputDensityOffset), InParams.OperatorSettings);
             TDataReadReference<bool> InputEnabled = InputData.GetOrCreateDefaultDataReadReference<bool>(METASOUND_GET_PARAM_NAME(InputEnabled), InParams.OperatorSettings);
+            TDataReadReference<int32> InputSeed = InputData.GetOrCreateDefaultDataReadReference<int32>(METASOUND_GET_PARAM_NAME(InputSeed), InParams.OperatorSettings);
             TDataReadReference<bool> InputBiPolar = InputData.GetOrCreateDefaultDataReadReference<bool>(METASOUND_GET_PARAM_NAME(InputBiPolar), InParams.OperatorSettings);
 
-            return MakeUnique<FDustOperator>(InParams.OperatorSettings, InputDensity, InputDensityOffset, InputEnabled, InputBiPolar);
+            return MakeUnique<FDustOperator>(InParams.OperatorSettings, InputDensity, InputDensityOffset, InputEnabled, InputSeed, InputBiPolar);
+        }
+
+        virtual void Reset(const IOperator::FResetParams& InParams)
+        {
+            OutputImpulse->Zero();
+
+            // Restart the random sequence: the same events again for a fixed seed, a fresh sequence for seed 0
+            CurrentSeed = *InputSeed;
+            Scheduler.SetSeed(ResolveSeed(CurrentSeed));
+            SignalIsPositive = true;
         }
 
         // Primary node functionality
         void Execute()
         {
-        const float* DensityData = InputDensity->GetData();
-        float* OutputDataPtr = OutputImpulse->GetData();
-        int32 NumFrames = InputDensity->Num();
-        float InputDensityOffsetValue = *InputDensityOffset;
-        bool bEnabled = *InputEnabled;
-        bool bBiPolar = *InputBiPolar;
+            METASOUNDBRANCHES_EXECUTE_SCOPE(FDustOperator);
 
-        for (int32 i = 0; i < NumFrames; ++i)
-        {
-            if (bEnabled)
+            const float* DensityData = InputDensity->GetData();
+            float* OutputDataPtr = OutputImpulse->GetData();
+            const int32 NumFrames = OutputImpulse->Num();
+            const bool bBiPolar = *InputBiPolar;
+
+            // Silence, plus a write per impulse
+            FMemory::Memzero(OutputDataPtr, sizeof(float) * NumFrames);
+
+            // Restart the sequence when the seed changes
+            if (*InputSeed != CurrentSeed)
+            {
+                CurrentSeed = *InputSeed;
+                Scheduler.SetSeed(ResolveSeed(CurrentSeed));
+                SignalIsPositive = true;
+            }
+
+            if (!*InputEnabled)
+            {
+                return;
+            }
+
+            Scheduler.Process(DensityData, *InputDensityOffset, NumFrames, [&](int32 Frame)
             {
-                float Density = DensityData[i];
-                float AbsDensity = FMath::Abs(Density) + InputDensityOffsetValue;
-                float Threshold = 1.0f - AbsDensity * 0.0009f;
+                if (bBiPolar)
+                {
+                    OutputDataPtr[Frame] = SignalIsPositive ? 1.0f : -1.0f;
+                    SignalIsPositive = !SignalIsPositive;
+                }
+                else
+                {
+                    OutputDataPtr[Frame] = 1.0f;
+                }
+            });
+        }
+
+    private:
+        METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(FDustOperator);
+
+        // Inputs
+        FAudioBufferReadRef InputDensity;
+		FFloatReadRef InputDensityOffset;
+        FBoolReadRef InputEnabled;
+        FInt32ReadRef InputSeed;
+        FBoolReadRef InputBiPolar;
+
+        // Outputs
+        FAudioBufferWriteRef OutputImpulse;
+
+        // Schedules impulses as a Poisson process
+        MetasoundBranches::FPoissonScheduler Scheduler;
+        
+        // Toggle flag for polarity
+        bool SignalIsPositive;
+
+        // Seed the scheduler was last started with, as set on the input
+        int32 CurrentSeed = 0;
+
+        // A seed of 0 asks for a different sequence every run
+        static uint32 ResolveSeed(int32 InSeed)
+        {
+            return InSeed != 0 ? static_cast<uint32>(InSeed) : static_cast<uint32>(FDateTime::UtcNow().GetTicks());
+        }
+    };
+
+    // Node Class - Inheriting from FNodeFacade is recommended for nodes that have a static FVertexInterface
+    class FDustNode : public FNodeFacade
+    {
+    public:
+        FDustNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FDustOperator>())
+        {
+        }
+    };
+
+    // Register node
+    METASOUND_REGISTER_NODE(FDustNode);
+
+    namespace DustNodeNamesV1
+    {
+        METASOUND_PARAM(InputDensity, "Modulation", "Density control signal.");
+        METASOUND_PARAM(InputDensityOffset, "Density", "Probability of impulse generation.");
+        METASOUND_PARAM(InputEnabled, "Enabled", "Enable or disable generation.");
+        METASOUND_PARAM(InputBiPolar, "Bi-Polar", "Toggle between bipolar and unipolar impulse output.");
+        METASOUND_PARAM(OutputImpulse, "Impulse Out", "Generated impulse output.");
+    }
+
+    // Version 1 of the node, kept so that graphs saved with it load and sound as before: Density is a per-sample
+    // probability scale rather than a rate in Hz, so its event rate depends on the sample rate. Hidden from the
+    // node browser in favour of version 2.
+    class FDustOperatorV1 : public TExecutableOperator<FDustOperatorV1>
+    {
+    public:
+        FDustOperatorV1(
+            const FOperatorSettings& InSettings,
+            const FAudioBufferReadRef& InDensity,
+            const FFloatReadRef& InDensityOffset,
+            const FBoolReadRef& InEnabled,
+            const FBoolReadRef& InBiPolar)
+            : InputDensity(InDensity)
+            , InputDensityOffset(InDensityOffset)
+            , InputEnabled(InEnabled)
+            , InputBiPolar(InBiPolar)
+            , OutputImpulse(FAudioBufferWriteRef::CreateNew(InSettings))
+            , RNGStream(InitialSeed())
+            , SignalIsPositive(true)
+        {
+        }
 
-                float RandomValue = RNGStream.GetFraction();
+        static const FVertexInterface& DeclareVertexInterface()
+        {
+            using namespace DustNodeNamesV1;
 
-                if (RandomValue > Threshold)
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputEnabled), true),
+                    TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputBiPolar), true),
+                    TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDensityOffset), 0.1f),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDensity))
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputImpulse))
+                )
+            );
+
+            return Interface;
+        }
+
+        static const FNodeClassMetadata& GetNodeInfo()
+        {
+            auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
                 {
-                    if (bBiPolar)
+                    FNodeClassMetadata Metadata;
+
+                    Metadata.ClassName = { TEXT("UE"), TEXT("Dust (Audio)"), TEXT("Audio") };
+                    Metadata.MajorVersion = 1;
+                    Metadata.MinorVersion = 0;
+                    Metadata.DisplayName = METASOUND_LOCTEXT("DustNodeDisplayName", "Dust (Audio)");
+                    Metadata.Description = METASOUND_LOCTEXT("DustNodeDesc", "Generate randomly timed impulses with audio-rate modulation.");
+                    Metadata.Author = "Charles Matthews";
+                    Metadata.PromptIfMissing = PluginNodeMissingPrompt;
+                    Metadata.DefaultInterface = DeclareVertexInterface();
+                    Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
+                    Metadata.Keywords = TArray<FText>();
+                    Metadata.bDeprecated = true;
+
+                    return Metadata;
+                };
+
+            static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+            return Metadata;
+        }
+
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
+        {
+            using namespace DustNodeNamesV1;
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputDensity), InputDensity);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputDensityOffset), InputDensityOffset);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputEnabled), InputEnabled);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputBiPolar), InputBiPolar);
+        }
+
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
+        {
+            using namespace DustNodeNamesV1;
+
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputImpulse), OutputImpulse);
+        }
+
+        static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+        {
+            using namespace DustNodeNamesV1;
+
+            const FInputVertexInterfaceData& InputData = InParams.InputData;
+
+            TDataReadReference<FAudioBuffer> InputDensity = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputDensity), InParams.OperatorSettings);
+            TDataReadReference<float> InputDensityOffset = InputData.GetOrCreateDefaultDataReadReference<float>(METASOUND_GET_PARAM_NAME(InputDensityOffset), InParams.OperatorSettings);
+            TDataReadReference<bool> InputEnabled = InputData.GetOrCreateDefaultDataReadReference<bool>(METASOUND_GET_PARAM_NAME(InputEnabled), InParams.OperatorSettings);
+            TDataReadReference<bool> InputBiPolar = InputData.GetOrCreateDefaultDataReadReference<bool>(METASOUND_GET_PARAM_NAME(InputBiPolar), InParams.OperatorSettings);
+
+            return MakeUnique<FDustOperatorV1>(InParams.OperatorSettings, InputDensity, InputDensityOffset, InputEnabled, InputBiPolar);
+        }
+
+        virtual void Reset(const IOperator::FResetParams& InParams)
+        {
+            OutputImpulse->Zero();
+            SignalIsPositive = true;
+        }
+
+        void Execute()
+        {
+            METASOUNDBRANCHES_EXECUTE_SCOPE(FDustOperatorV1);
+
+            const float* DensityData = InputDensity->GetData();
+            float* OutputDataPtr = OutputImpulse->GetData();
+            const int32 NumFrames = InputDensity->Num();
+            const float InputDensityOffsetValue = *InputDensityOffset;
+            const bool bEnabled = *InputEnabled;
+            const bool bBiPolar = *InputBiPolar;
+
+            for (int32 i = 0; i < NumFrames; ++i)
+            {
+                if (bEnabled)
+                {
+                    const float AbsDensity = FMath::Abs(DensityData[i]) + InputDensityOffsetValue;
+                    const float Threshold = 1.0f - AbsDensity * 0.0009f;
+
+                    if (RNGStream.GetFraction() > Threshold)
                     {
-                        OutputDataPtr[i] = SignalIsPositive ? 1.0f : -1.0f;
-                        SignalIsPositive = !SignalIsPositive; 
+                        if (bBiPolar)
+                        {
+                            OutputDataPtr[i] = SignalIsPositive ? 1.0f : -1.0f;
+                            SignalIsPositive = !SignalIsPositive;
+                        }
+                        else
+                        {
+                            OutputDataPtr[i] = 1.0f;
+                        }
                     }
                     else
                     {
-                        OutputDataPtr[i] = 1.0f;
+                        OutputDataPtr[i] = 0.0f;
                     }
                 }
                 else
@@ -169,18 +382,14 @@ namespace Metasound
                     OutputDataPtr[i] = 0.0f;
                 }
             }
-            else
-            {
-                OutputDataPtr[i] = 0.0f; // Output zero when disabled
-            }
         }
-    }
 
     private:
+        METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(FDustOperatorV1);
 
         // Inputs
         FAudioBufferReadRef InputDensity;
-		FFloatReadRef InputDensityOffset;
+        FFloatReadRef InputDensityOffset;
         FBoolReadRef InputEnabled;
         FBoolReadRef InputBiPolar;
 
@@ -189,29 +398,26 @@ namespace Metasound
 
         // Random number generator
         FRandomStream RNGStream;
-        
+
         // Toggle flag for polarity
         bool SignalIsPositive;
 
-        // Generate an initial seed for FRandomStream
         static int32 InitialSeed()
         {
             return FDateTime::UtcNow().GetTicks();
         }
     };
 
-    // Node Class - Inheriting from FNodeFacade is recommended for nodes that have a static FVertexInterface
-    class FDustNode : public FNodeFacade
+    class FDustNodeV1 : public FNodeFacade
     {
     public:
-        FDustNode(const FNodeInitData& InitData)
-            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FDustOperator>())
+        FDustNodeV1(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FDustOperatorV1>())
         {
         }
     };
 
-    // Register node
-    METASOUND_REGISTER_NODE(FDustNode);
+    METASOUND_REGISTER_NODE(FDustNodeV1);
 }
 
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -1,26 +1,33 @@
 // Copyright 2025 Charles Matthews. All Rights Reserved.
 
 #include "MetasoundBranches/Public/MetasoundDustTriggerNode.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
+#include "MetasoundBranches/Private/DSP/PoissonScheduler.h"
 #include "MetasoundExecutableOperator.h"     // TExecutableOperator class
 #include "MetasoundPrimitives.h"             // ReadRef and WriteRef descriptions for bool, int32, float, and string
 #include "MetasoundNodeRegistrationMacro.h"  // METASOUND_LOCTEXT and METASOUND_REGISTER_NODE macros
 #include "MetasoundFacade.h"                 // FNodeFacade class, eliminates the need for a fair amount of boilerplate code
 #include "MetasoundParamHelper.h"            // METASOUND_PARAM and METASOUND_GET_PARAM family of macros
 #include "Math/UnrealMathUtility.h"          // For FMath functions
+#include "Math/RandomStream.h"               // For FRandomStream, used by the version 1 node
 #include "Misc/DateTime.h"                   // For FDateTime::UtcNow()
 #include "MetasoundTrigger.h"                // For FTrigger classes
 
 // Required for ensuring the node is supported by all languages in engine. Must be unique per MetaSound.
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodes_DustTriggerNode"
 
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FDustTriggerOperator);
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FDustTriggerOperatorV1);
+
 namespace Metasound
 {
     // Vertex Names - define the node's inputs and outputs here
     namespace DustTriggerNodeNames
     {
-        METASOUND_PARAM(InputDensity, "Modulation", "Input density control signal.");
-        METASOUND_PARAM(InputDensityOffset, "Density", "Probability of trigger generation.");
+        METASOUND_PARAM(InputDensity, "Modulation", "Input density control signal, in Hz (its absolute value is added to Density).");
+        METASOUND_PARAM(InputDensityOffset, "Density", "Average number of triggers per second (Hz).");
         METASOUND_PARAM(InputEnabled, "Enabled", "Enable or disable generation.");
+        METASOUND_PARAM(InputSeed, "Seed", "Random seed. The same seed always gives the same events; 0 picks a new seed each time the node is created.");
         METASOUND_PARAM(OutputTrigger, "Trigger Out", "Generated trigger output.");
     }
 
@@ -33,13 +40,16 @@ namespace Metasound
             const FOperatorSettings& InSettings,
             const FAudioBufferReadRef& InDensity,
             const FFloatReadRef& InDensityOffset,
-            const FBoolReadRef& InEnabled)
+            const FBoolReadRef& InEnabled,
+            const FInt32ReadRef& InSeed)
             : InputDensity(InDensity)
             , InputDensityOffset(InDensityOffset)
             , InputEnabled(InEnabled)
+            , InputSeed(InSeed)
             , OutputTrigger(FTriggerWriteRef::CreateNew(InSettings))
-            , RNGStream(InitialSeed())
         {
+            CurrentSeed = *InputSeed;
+            Scheduler.Init(InSettings.GetSampleRate(), ResolveSeed(CurrentSeed));
         }
 
         // Helper function for constructing vertex interface
@@ -50,8 +60,9 @@ namespace Metasound
             static const FVertexInterface Interface(
                 FInputVertexInterface(
                     TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputEnabled), true),
-                    TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDensityOffset), 0.1f),
-                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDensity))
+                    TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDensityOffset), 5.0f),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDensity)),
+                    TInputDataVertex<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputSeed), 0)
                 ),
                 FOutputVertexInterface(
                     TOutputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputTrigger))
@@ -71,7 +82,7 @@ namespace Metasound
                     FNodeClassMetadata Metadata;
 
                     Metadata.ClassName = { TEXT("UE"), TEXT("Dust (Trigger)"), TEXT("Trigger") };
-                    Metadata.MajorVersion = 1;
+                    Metadata.MajorVersion = 2;
                     Metadata.MinorVersion = 0;
                     Metadata.DisplayName = METASOUND_LOCTEXT("DustTriggerNodeDisplayName", "Dust (Trigger)");
                     Metadata.Description = METASOUND_LOCTEXT("DustTriggerNodeDesc", "Generate randomly timed trigger events, with audio-rate modulation.");
@@ -89,26 +100,21 @@ namespace Metasound
         }
 
         // Allows MetaSound graph to interact with the node's inputs
-        virtual FDataReferenceCollection GetInputs() const override
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
         {
             using namespace DustTriggerNodeNames;
-            FDataReferenceCollection Inputs;
-            Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputDensity), InputDensity);
-            Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputDensityOffset), InputDensityOffset);
-            Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputEnabled), InputEnabled);
-            return Inputs;
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputDensity), InputDensity);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputDensityOffset), InputDensityOffset);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputEnabled), InputEnabled);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputSeed), InputSeed);
         }
 
         // Allows MetaSound graph to interact with the node's outputs
-        virtual FDataReferenceCollection GetOutputs() const override
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
         {
             using namespace DustTriggerNodeNames;
 
-            FDataReferenceCollection OutputDataReferences;
-
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputTrigger), OutputTrigger);
-
-            return OutputDataReferences;
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputTrigger), OutputTrigger);
         }
 
         // Used to instantiate a new runtime instance of the node
@@ -122,38 +128,216 @@ namespace Metasound
             TDataReadReference<FAudioBuffer> InputDensity = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputDensity), InParams.OperatorSettings);
             TDataReadReference<float> InputDensityOffset = InputData.GetOrCreateDefaultDataReadReference<float>(METASOUND_GET_PARAM_NAME(InputDensityOffset), InParams.OperatorSettings);
             TDataReadReference<bool> InputEnabled = InputData.GetOrCreateDefaultDataReadReference<bool>(METASOUND_GET_PARAM_NAME(InputEnabled), InParams.OperatorSettings);
+            TDataReadReference<int32> InputSeed = InputData.GetOrCreateDefaultDataReadReference<int32>(METASOUND_GET_PARAM_NAME(InputSeed), InParams.OperatorSettings);
 
-            return MakeUnique<FDustTriggerOperator>(InParams.OperatorSettings, InputDensity, InputDensityOffset, InputEnabled);
+            return MakeUnique<FDustTriggerOperator>(InParams.OperatorSettings, InputDensity, InputDensityOffset, InputEnabled, InputSeed);
+        }
+
+        virtual void Reset(const IOperator::FResetParams& InParams)
+        {
+            OutputTrigger->Reset();
+
+            // Restart the random sequence: the same events again for a fixed seed, a fresh sequence for seed 0
+            CurrentSeed = *InputSeed;
+            Scheduler.SetSeed(ResolveSeed(CurrentSeed));
         }
 
         // Primary node functionality
         void Execute()
         {
+            METASOUNDBRANCHES_EXECUTE_SCOPE(FDustTriggerOperator);
+
             OutputTrigger->AdvanceBlock();
             const float* DensityData = InputDensity->GetData();
-            int32 NumFrames = InputDensity->Num();
-            float InputDensityOffsetValue = *InputDensityOffset;
-            bool bEnabled = *InputEnabled;
+            const int32 NumFrames = InputDensity->Num();
 
-            for (int32 i = 0; i < NumFrames; ++i)
+            // Restart the sequence when the seed changes
+            if (*InputSeed != CurrentSeed)
+            {
+                CurrentSeed = *InputSeed;
+                Scheduler.SetSeed(ResolveSeed(CurrentSeed));
+            }
+
+            if (!*InputEnabled)
             {
-                if (bEnabled)
+                return;
+            }
+
+            Scheduler.Process(DensityData, *InputDensityOffset, NumFrames, [&](int32 Frame)
+            {
+                OutputTrigger->TriggerFrame(Frame);
+            });
+        }
+
+    private:
+        METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(FDustTriggerOperator);
+
+        // Inputs
+        FAudioBufferReadRef InputDensity;
+        FFloatReadRef InputDensityOffset;
+        FBoolReadRef InputEnabled;
+        FInt32ReadRef InputSeed;
+
+        // Output
+        FTriggerWriteRef OutputTrigger;
+
+        // Schedules triggers as a Poisson process
+        MetasoundBranches::FPoissonScheduler Scheduler;
+
+        // Seed the scheduler was last started with, as set on the input
+        int32 CurrentSeed = 0;
+
+        // A seed of 0 asks for a different sequence every run
+        static uint32 ResolveSeed(int32 InSeed)
+        {
+            return InSeed != 0 ? static_cast<uint32>(InSeed) : static_cast<uint32>(FDateTime::UtcNow().GetTicks());
+        }
+    };
+
+    // Node Class - Inheriting from FNodeFacade is recommended for nodes that have a static FVertexInterface
+    class FDustTriggerNode : public FNodeFacade
+    {
+    public:
+        FDustTriggerNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FDustTriggerOperator>())
+        {
+        }
+    };
+
+    // Register node
+    METASOUND_REGISTER_NODE(FDustTriggerNode);
+
+    namespace DustTriggerNodeNamesV1
+    {
+        METASOUND_PARAM(InputDensity, "Modulation", "Input density control signal.");
+        METASOUND_PARAM(InputDensityOffset, "Density", "Probability of trigger generation.");
+        METASOUND_PARAM(InputEnabled, "Enabled", "Enable or disable generation.");
+        METASOUND_PARAM(OutputTrigger, "Trigger Out", "Generated trigger output.");
+    }
+
+    // Version 1 of the node, kept so that graphs saved with it load and sound as before: Density is a per-sample
+    // probability scale rather than a rate in Hz. Hidden from the node browser in favour of version 2.
+    class FDustTriggerOperatorV1 : public TExecutableOperator<FDustTriggerOperatorV1>
+    {
+    public:
+        FDustTriggerOperatorV1(
+            const FOperatorSettings& InSettings,
+            const FAudioBufferReadRef& InDensity,
+            const FFloatReadRef& InDensityOffset,
+            const FBoolReadRef& InEnabled)
+            : InputDensity(InDensity)
+            , InputDensityOffset(InDensityOffset)
+            , InputEnabled(InEnabled)
+            , OutputTrigger(FTriggerWriteRef::CreateNew(InSettings))
+            , RNGStream(InitialSeed())
+        {
+        }
+
+        static const FVertexInterface& DeclareVertexInterface()
+        {
+            using namespace DustTriggerNodeNamesV1;
+
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputEnabled), true),
+                    TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDensityOffset), 0.1f),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDensity))
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputTrigger))
+                )
+            );
+
+            return Interface;
+        }
+
+        static const FNodeClassMetadata& GetNodeInfo()
+        {
+            auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
                 {
-                    float Density = DensityData[i];
-                    float AbsDensity = FMath::Abs(Density) + InputDensityOffsetValue;
-                    float Threshold = 1.0f - AbsDensity * 0.0009f;
+                    FNodeClassMetadata Metadata;
+
+                    Metadata.ClassName = { TEXT("UE"), TEXT("Dust (Trigger)"), TEXT("Trigger") };
+                    Metadata.MajorVersion = 1;
+                    Metadata.MinorVersion = 0;
+                    Metadata.DisplayName = METASOUND_LOCTEXT("DustTriggerNodeDisplayName", "Dust (Trigger)");
+                    Metadata.Description = METASOUND_LOCTEXT("DustTriggerNodeDesc", "Generate randomly timed trigger events, with audio-rate modulation.");
+                    Metadata.Author = "Charles Matthews";
+                    Metadata.PromptIfMissing = PluginNodeMissingPrompt;
+                    Metadata.DefaultInterface = DeclareVertexInterface();
+                    Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
+                    Metadata.Keywords = TArray<FText>();
+                    Metadata.bDeprecated = true;
+
+                    return Metadata;
+                };
+
+            static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+            return Metadata;
+        }
+
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
+        {
+            using namespace DustTriggerNodeNamesV1;
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputDensity), InputDensity);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputDensityOffset), InputDensityOffset);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputEnabled), InputEnabled);
+        }
+
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
+        {
+            using namespace DustTriggerNodeNamesV1;
+
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputTrigger), OutputTrigger);
+        }
+
+        static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+        {
+            using namespace DustTriggerNodeNamesV1;
+
+            const FInputVertexInterfaceData& InputData = InParams.InputData;
+
+            TDataReadReference<FAudioBuffer> InputDensity = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputDensity), InParams.OperatorSettings);
+            TDataReadReference<float> InputDensityOffset = InputData.GetOrCreateDefaultDataReadReference<float>(METASOUND_GET_PARAM_NAME(InputDensityOffset), InParams.OperatorSettings);
+            TDataReadReference<bool> InputEnabled = InputData.GetOrCreateDefaultDataReadReference<bool>(METASOUND_GET_PARAM_NAME(InputEnabled), InParams.OperatorSettings);
+
+            return MakeUnique<FDustTriggerOperatorV1>(InParams.OperatorSettings, InputDensity, InputDensityOffset, InputEnabled);
+        }
+
+        virtual void Reset(const IOperator::FResetParams& InParams)
+        {
+            OutputTrigger->Reset();
+        }
 
-                    float RandomValue = RNGStream.GetFraction();
+        void Execute()
+        {
+            METASOUNDBRANCHES_EXECUTE_SCOPE(FDustTriggerOperatorV1);
+
+            OutputTrigger->AdvanceBlock();
+
+            if (!*InputEnabled)
+            {
+                return;
+            }
 
-                    if (RandomValue > Threshold)
-                    {
-                        OutputTrigger->TriggerFrame(i);
-                    }
+            const float* DensityData = InputDensity->GetData();
+            const int32 NumFrames = InputDensity->Num();
+            const float InputDensityOffsetValue = *InputDensityOffset;
+
+            for (int32 i = 0; i < NumFrames; ++i)
+            {
+                const float AbsDensity = FMath::Abs(DensityData[i]) + InputDensityOffsetValue;
+                const float Threshold = 1.0f - AbsDensity * 0.0009f;
+
+                if (RNGStream.GetFraction() > Threshold)
+                {
+                    OutputTrigger->TriggerFrame(i);
                 }
             }
         }
 
     private:
+        METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(FDustTriggerOperatorV1);
 
         // Inputs
         FAudioBufferReadRef InputDensity;
@@ -166,25 +350,22 @@ namespace Metasound
         // Random number generator
         FRandomStream RNGStream;
 
-        // Generate an initial seed for FRandomStream
         static int32 InitialSeed()
         {
             return FDateTime::UtcNow().GetTicks();
         }
     };
 
-    // Node Class - Inheriting from FNodeFacade is recommended for nodes that have a static FVertexInterface
-    class FDustTriggerNode : public FNodeFacade
+    class FDustTriggerNodeV1 : public FNodeFacade
     {
     public:
-        FDustTriggerNode(const FNodeInitData& InitData)
-            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FDustTriggerOperator>())
+        FDustTriggerNodeV1(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FDustTriggerOperatorV1>())
         {
         }
     };
 
-    // Register node
-    METASOUND_REGISTER_NODE(FDustTriggerNode);
+    METASOUND_REGISTER_NODE(FDustTriggerNodeV1);
 }
 
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
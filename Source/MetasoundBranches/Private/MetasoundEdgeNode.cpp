@@ -1,6 +1,8 @@
 // Copyright 2025 Charles Matthews. All Rights Reserved.
 
 #include "MetasoundBranches/Public/MetasoundEdgeNode.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
+#include "MetasoundBranches/Private/DSP/EdgeDetector.h"
 #include "MetasoundExecutableOperator.h"     // TExecutableOperator class
 #include "MetasoundPrimitives.h"             // ReadRef and WriteRef descriptions for bool, int32, float, and string
 #include "MetasoundNodeRegistrationMacro.h"  // METASOUND_LOCTEXT and METASOUND_REGISTER_NODE macros
@@ -10,6 +12,8 @@
 
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodes_Edge"
 
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FEdgeOperator);
+
 namespace Metasound
 {
     namespace EdgeNames
@@ -34,11 +38,8 @@ namespace Metasound
             , InputDebounce(InDebounce)
             , OutputTriggerRise(FTriggerWriteRef::CreateNew(InSettings))
             , OutputTriggerFall(FTriggerWriteRef::CreateNew(InSettings))
-            , PreviousSignalValue(0.0f)
-            , DebounceSamples(0)
-            , DebounceCounter(0)
-            , SampleRate(InSampleRate)
         {
+            Detector.Init(InSampleRate);
         }
 
         static const FVertexInterface& DeclareVertexInterface()
@@ -85,28 +86,20 @@ namespace Metasound
             return Metadata;
         }
 
-        virtual FDataReferenceCollection GetInputs() const override
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
         {
             using namespace EdgeNames;
 
-            FDataReferenceCollection InputDataReferences;
-
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputSignal), InputSignal);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputDebounce), InputDebounce);
-
-            return InputDataReferences;
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputSignal), InputSignal);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputDebounce), InputDebounce);
         }
 
-        virtual FDataReferenceCollection GetOutputs() const override
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
         {
             using namespace EdgeNames;
 
-            FDataReferenceCollection OutputDataReferences;
-
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputTriggerRise), OutputTriggerRise);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputTriggerFall), OutputTriggerFall);
-
-            return OutputDataReferences;
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputTriggerRise), OutputTriggerRise);
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputTriggerFall), OutputTriggerFall);
         }
 
         static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
@@ -133,70 +126,27 @@ namespace Metasound
             OutputTriggerRise->Reset();
             OutputTriggerFall->Reset();
 
-            // Initialize PreviousSignalValue to the first sample of the incoming signal to prevent false triggers
-            if (InputSignal->Num() > 0)
-            {
-                PreviousSignalValue = InputSignal->GetData()[0];
-            }
-            else
-            {
-                PreviousSignalValue = 0.0f;
-            }
-
-            // Reset debounce counter
-            DebounceCounter = 0;
+            // Start from the first sample of the incoming signal to prevent false triggers
+            Detector.Reset(InputSignal->Num() > 0 ? InputSignal->GetData()[0] : 0.0f);
         }
 
         void Execute()
         {
+            METASOUNDBRANCHES_EXECUTE_SCOPE(FEdgeOperator);
+
             OutputTriggerRise->AdvanceBlock();
             OutputTriggerFall->AdvanceBlock();
 
-            const float* SignalData = InputSignal->GetData();
-            int32 NumFrames = InputSignal->Num();
-            const float DebounceTime = InputDebounce->GetSeconds();
-
-            // Recalculate debounce samples if debounce time or sample rate has changed
-            if (LastDebounceTime != DebounceTime || LastSampleRate != SampleRate)
-            {
-                DebounceSamples = FMath::RoundToInt(FMath::Clamp(DebounceTime, 0.001f, 5.0f) * SampleRate);
-                LastDebounceTime = DebounceTime;
-                LastSampleRate = SampleRate;
-            }
+            Detector.SetDebounceTime(InputDebounce->GetSeconds());
 
-            for (int32 i = 0; i < NumFrames; ++i)
-            {
-                float CurrentSignal = SignalData[i];
-
-                // Decrement debounce counter
-                if (DebounceCounter > 0)
-                {
-                    DebounceCounter--;
-                }
-
-                // Detect rising edge
-                if (CurrentSignal > PreviousSignalValue && !PreviousIsRising && DebounceCounter <= 0)
-                {
-                    // Rising edge detected
-                    OutputTriggerRise->TriggerFrame(i);
-                    DebounceCounter = DebounceSamples;
-                    PreviousIsRising = true;
-                }
-                // Detect falling edge
-                else if (CurrentSignal < PreviousSignalValue && PreviousIsRising && DebounceCounter <= 0)
-                {
-                    // Falling edge detected
-                    OutputTriggerFall->TriggerFrame(i);
-                    DebounceCounter = DebounceSamples;
-                    PreviousIsRising = false;
-                }
-
-                // Update previous signal value
-                PreviousSignalValue = CurrentSignal;
-            }
+            Detector.Process(InputSignal->GetData(), InputSignal->Num(),
+                [this](int32 Frame) { OutputTriggerRise->TriggerFrame(Frame); },
+                [this](int32 Frame) { OutputTriggerFall->TriggerFrame(Frame); });
         }
 
     private:
+        METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(FEdgeOperator);
+
         // Inputs
         FAudioBufferReadRef InputSignal;
         FTimeReadRef InputDebounce;
@@ -205,16 +155,8 @@ namespace Metasound
         FTriggerWriteRef OutputTriggerRise;
         FTriggerWriteRef OutputTriggerFall;
 
-        // Internal variables
-        float PreviousSignalValue;
-        bool PreviousIsRising = false;
-        int32 DebounceSamples;
-        int32 DebounceCounter;
-        float SampleRate;
-        
-        // Variables to track changes in debounce time and sample rate
-        float LastDebounceTime = -1.0f;
-        float LastSampleRate = -1.0f;
+        // Edge and debounce state
+        MetasoundBranches::FEdgeDetector Detector;
     };
 
     class FEdgeNode : public FNodeFacade
@@ -1,6 +1,7 @@
 // Copyright 2025 Charles Matthews. All Rights Reserved.
 
 #include "MetasoundBranches/Public/MetasoundEdoNode.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
 #include "MetasoundExecutableOperator.h"
 #include "MetasoundPrimitives.h"
 #include "MetasoundNodeRegistrationMacro.h"
@@ -9,6 +10,8 @@
 
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodes_EdoNode"
 
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FEdoNodeOperator);
+
 namespace Metasound
 {
     namespace EdoNodeNames
@@ -82,29 +85,21 @@ namespace Metasound
             return Metadata;
         }
 
-        virtual FDataReferenceCollection GetInputs() const override
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
         {
             using namespace EdoNodeNames;
 
-            FDataReferenceCollection InputDataReferences;
-
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputNoteNumber), NoteNumber);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputReferenceFrequency), ReferenceFrequency);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputReferenceMIDINote), ReferenceMIDINote);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputDivisions), Divisions);
-
-            return InputDataReferences;
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputNoteNumber), NoteNumber);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputReferenceFrequency), ReferenceFrequency);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputReferenceMIDINote), ReferenceMIDINote);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputDivisions), Divisions);
         }
 
-        virtual FDataReferenceCollection GetOutputs() const override
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
         {
             using namespace EdoNodeNames;
 
-            FDataReferenceCollection OutputDataReferences;
-
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputFrequency), OutputFrequency);
-
-            return OutputDataReferences;
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputFrequency), OutputFrequency);
         }
 
         static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
@@ -128,7 +123,22 @@ namespace Metasound
             );
         }
 
+        virtual void Reset(const IOperator::FResetParams& InParams)
+        {
+            // No state: the output depends only on the inputs
+            UpdateFrequency();
+        }
+
         void Execute()
+        {
+            METASOUNDBRANCHES_EXECUTE_SCOPE(FEdoNodeOperator);
+
+            UpdateFrequency();
+        }
+
+    private:
+        // Shared by Execute and Reset, so resets stay out of the execute stats
+        void UpdateFrequency()
         {
             int32 noteNumber = *NoteNumber;
             float refFreq = *ReferenceFrequency;
@@ -146,7 +156,8 @@ namespace Metasound
             *OutputFrequency = frequency;
         }
 
-    private:
+        METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(FEdoNodeOperator);
+
         FInt32ReadRef NoteNumber;
         FFloatReadRef ReferenceFrequency;
         FInt32ReadRef ReferenceMIDINote;
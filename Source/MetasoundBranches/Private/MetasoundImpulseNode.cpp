@@ -1,6 +1,7 @@
 // Copyright 2025 Charles Matthews. All Rights Reserved.
 
 #include "MetasoundBranches/Public/MetasoundImpulseNode.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
 #include "MetasoundExecutableOperator.h"     // TExecutableOperator class
 #include "MetasoundPrimitives.h"             // ReadRef and WriteRef descriptions for bool, int32, float, and string
 #include "MetasoundNodeRegistrationMacro.h"  // METASOUND_LOCTEXT and METASOUND_REGISTER_NODE macros
@@ -10,6 +11,8 @@
 // Required for ensuring the node is supported by all languages in engine. Must be unique per MetaSound.
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodes_ImpulseNode"
 
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FImpulseOperator);
+
 namespace Metasound
 {
     // Vertex Names - define the node's inputs and outputs here
@@ -85,26 +88,20 @@ namespace Metasound
         }
 
         // Allows MetaSound graph to interact with the node's inputs
-        virtual FDataReferenceCollection GetInputs() const override
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
         {
             using namespace ImpulseNodeNames;
-            FDataReferenceCollection Inputs;
-            Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputTrigger), InputTrigger);
-            Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputBiPolar), InputBiPolar);
-            return Inputs;
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputTrigger), InputTrigger);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputBiPolar), InputBiPolar);
         }
 
         // Allows MetaSound graph to interact with the node's outputs
-        virtual FDataReferenceCollection GetOutputs() const override
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
         {
             using namespace ImpulseNodeNames;
 
-            FDataReferenceCollection OutputDataReferences;
-            
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputOnTrigger), OnTrigger);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputImpulse), OutputImpulse);
-
-            return OutputDataReferences;
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputOnTrigger), OnTrigger);
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputImpulse), OutputImpulse);
         }
 
           static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
@@ -124,9 +121,19 @@ namespace Metasound
             );
         }
 
+        virtual void Reset(const IOperator::FResetParams& InParams)
+        {
+            OnTrigger->Reset();
+            OutputImpulse->Zero();
+
+            SignalIsPositive = true;
+        }
+
         // Primary node functionality
         void Execute()
         {
+            METASOUNDBRANCHES_EXECUTE_SCOPE(FImpulseOperator);
+
             OnTrigger->AdvanceBlock();
             OutputImpulse->Zero(); // Ensure the output buffer is cleared
             
@@ -164,6 +171,7 @@ namespace Metasound
         }
 
     private:
+        METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(FImpulseOperator);
 
         // Inputs
         FTriggerReadRef InputTrigger;
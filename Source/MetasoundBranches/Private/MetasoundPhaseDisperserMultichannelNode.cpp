@@ -0,0 +1,282 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Public/MetasoundPhaseDisperserMultichannelNode.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
+#include "MetasoundBranches/Private/DSP/InterleavedAllPassChain.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundFacade.h"
+#include "MetasoundParamHelper.h"
+#include "Math/UnrealMathUtility.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStandardNodes_PhaseDisperserMultichannelNode"
+
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(TPhaseDisperserMultichannelOperator);
+
+namespace Metasound
+{
+    namespace PhaseDisperserMultichannelNodeNames
+    {
+        METASOUND_PARAM(InputLeftSignal, "In L", "Left channel audio input.");
+        METASOUND_PARAM(InputRightSignal, "In R", "Right channel audio input.");
+        METASOUND_PARAM(OutputLeftSignal, "Out L", "Phase-dispersed left channel.");
+        METASOUND_PARAM(OutputRightSignal, "Out R", "Phase-dispersed right channel.");
+
+        METASOUND_PARAM(InputSignal1, "In 1", "Audio input, channel 1.");
+        METASOUND_PARAM(InputSignal2, "In 2", "Audio input, channel 2.");
+        METASOUND_PARAM(InputSignal3, "In 3", "Audio input, channel 3.");
+        METASOUND_PARAM(InputSignal4, "In 4", "Audio input, channel 4.");
+        METASOUND_PARAM(OutputSignal1, "Out 1", "Phase-dispersed audio, channel 1.");
+        METASOUND_PARAM(OutputSignal2, "Out 2", "Phase-dispersed audio, channel 2.");
+        METASOUND_PARAM(OutputSignal3, "Out 3", "Phase-dispersed audio, channel 3.");
+        METASOUND_PARAM(OutputSignal4, "Out 4", "Phase-dispersed audio, channel 4.");
+
+        METASOUND_PARAM(NumFilters, "Stages", "Number of allpass filter stages to apply to every channel (maximum 128).");
+    }
+
+    // Phase Disperser for two or four channels, processed together in SIMD lanes
+    template<int32 NumChannels>
+    class TPhaseDisperserMultichannelOperator : public TExecutableOperator<TPhaseDisperserMultichannelOperator<NumChannels>>
+    {
+    public:
+        // Maximum number of allowed allpass filters
+        static constexpr int32 MaxAllowedFilters = 128;
+
+        TPhaseDisperserMultichannelOperator(
+            const FOperatorSettings& InSettings,
+            const TArray<FAudioBufferReadRef>& InSignals,
+            const FInt32ReadRef& InNumFilters)
+            : InputSignals(InSignals)
+            , NumFilters(InNumFilters)
+        {
+            for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+            {
+                OutputSignals.Add(FAudioBufferWriteRef::CreateNew(InSettings));
+            }
+
+            AllPassChain.Init(MaxAllowedFilters);
+
+            // One spare frame, as the stereo chain reads a frame ahead
+            Interleaved.SetNumZeroed((InSettings.GetNumFramesPerBlock() + 1) * NumChannels);
+        }
+
+        static FVertexName GetInputName(int32 Channel)
+        {
+            using namespace PhaseDisperserMultichannelNodeNames;
+
+            static const FVertexName StereoNames[] = { METASOUND_GET_PARAM_NAME(InputLeftSignal), METASOUND_GET_PARAM_NAME(InputRightSignal) };
+            static const FVertexName QuadNames[] = { METASOUND_GET_PARAM_NAME(InputSignal1), METASOUND_GET_PARAM_NAME(InputSignal2), METASOUND_GET_PARAM_NAME(InputSignal3), METASOUND_GET_PARAM_NAME(InputSignal4) };
+
+            return (NumChannels == 2) ? StereoNames[Channel] : QuadNames[Channel];
+        }
+
+        static FVertexName GetOutputName(int32 Channel)
+        {
+            using namespace PhaseDisperserMultichannelNodeNames;
+
+            static const FVertexName StereoNames[] = { METASOUND_GET_PARAM_NAME(OutputLeftSignal), METASOUND_GET_PARAM_NAME(OutputRightSignal) };
+            static const FVertexName QuadNames[] = { METASOUND_GET_PARAM_NAME(OutputSignal1), METASOUND_GET_PARAM_NAME(OutputSignal2), METASOUND_GET_PARAM_NAME(OutputSignal3), METASOUND_GET_PARAM_NAME(OutputSignal4) };
+
+            return (NumChannels == 2) ? StereoNames[Channel] : QuadNames[Channel];
+        }
+
+        static const FVertexInterface& DeclareVertexInterface()
+        {
+            using namespace PhaseDisperserMultichannelNodeNames;
+
+            if constexpr (NumChannels == 2)
+            {
+                static const FVertexInterface Interface(
+                    FInputVertexInterface(
+                        TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputLeftSignal)),
+                        TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputRightSignal)),
+                        TInputDataVertex<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(NumFilters))
+                    ),
+                    FOutputVertexInterface(
+                        TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputLeftSignal)),
+                        TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputRightSignal))
+                    )
+                );
+
+                return Interface;
+            }
+            else
+            {
+                static const FVertexInterface Interface(
+                    FInputVertexInterface(
+                        TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputSignal1)),
+                        TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputSignal2)),
+                        TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputSignal3)),
+                        TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputSignal4)),
+                        TInputDataVertex<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(NumFilters))
+                    ),
+                    FOutputVertexInterface(
+                        TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputSignal1)),
+                        TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputSignal2)),
+                        TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputSignal3)),
+                        TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputSignal4))
+                    )
+                );
+
+                return Interface;
+            }
+        }
+
+        static const FNodeClassMetadata& GetNodeInfo()
+        {
+            auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
+            {
+                FNodeClassMetadata Metadata;
+
+                if constexpr (NumChannels == 2)
+                {
+                    Metadata.ClassName = { TEXT("UE"), TEXT("PhaseDisperser"), TEXT("Stereo") };
+                    Metadata.DisplayName = METASOUND_LOCTEXT("PhaseDisperserStereoNodeDisplayName", "Phase Disperser (Stereo)");
+                    Metadata.Description = METASOUND_LOCTEXT("PhaseDisperserStereoNodeDesc", "A chain of allpass filters acting as a phase disperser to soften transients, for a stereo signal.");
+                }
+                else
+                {
+                    Metadata.ClassName = { TEXT("UE"), TEXT("PhaseDisperser"), TEXT("Quad") };
+                    Metadata.DisplayName = METASOUND_LOCTEXT("PhaseDisperserQuadNodeDisplayName", "Phase Disperser (Quad)");
+                    Metadata.Description = METASOUND_LOCTEXT("PhaseDisperserQuadNodeDesc", "A chain of allpass filters acting as a phase disperser to soften transients, for four channels.");
+                }
+
+                Metadata.MajorVersion = 1;
+                Metadata.MinorVersion = 0;
+                Metadata.Author = "Charles Matthews";
+                Metadata.PromptIfMissing = PluginNodeMissingPrompt;
+                Metadata.DefaultInterface = DeclareVertexInterface();
+                Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
+                Metadata.Keywords = TArray<FText>(); // Keywords for searching
+
+                return Metadata;
+            };
+
+            static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+            return Metadata;
+        }
+
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
+        {
+            using namespace PhaseDisperserMultichannelNodeNames;
+
+            for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+            {
+                InVertexData.BindReadVertex(GetInputName(Channel), InputSignals[Channel]);
+            }
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(NumFilters), NumFilters);
+        }
+
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
+        {
+            for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+            {
+                InVertexData.BindWriteVertex(GetOutputName(Channel), OutputSignals[Channel]);
+            }
+        }
+
+        static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+        {
+            using namespace PhaseDisperserMultichannelNodeNames;
+
+            const FInputVertexInterfaceData& InputData = InParams.InputData;
+
+            TArray<FAudioBufferReadRef> InputSignals;
+            for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+            {
+                InputSignals.Add(InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(GetInputName(Channel), InParams.OperatorSettings));
+            }
+
+            TDataReadReference<int32> NumFiltersRef = InputData.GetOrCreateDefaultDataReadReference<int32>(
+                METASOUND_GET_PARAM_NAME(NumFilters), InParams.OperatorSettings);
+
+            return MakeUnique<TPhaseDisperserMultichannelOperator<NumChannels>>(InParams.OperatorSettings, InputSignals, NumFiltersRef);
+        }
+
+        virtual void Reset(const IOperator::FResetParams& InParams)
+        {
+            for (FAudioBufferWriteRef& OutputSignal : OutputSignals)
+            {
+                OutputSignal->Zero();
+            }
+
+            AllPassChain.Reset();
+            FMemory::Memzero(Interleaved.GetData(), Interleaved.Num() * sizeof(float));
+        }
+
+        void Execute()
+        {
+            METASOUNDBRANCHES_EXECUTE_SCOPE(TPhaseDisperserMultichannelOperator);
+
+            const int32 NumFrames = FMath::Min(InputSignals[0]->Num(), Interleaved.Num() / NumChannels - 1);
+            float* InterleavedData = Interleaved.GetData();
+
+            for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+            {
+                const float* InputData = InputSignals[Channel]->GetData();
+
+                for (int32 i = 0; i < NumFrames; ++i)
+                {
+                    InterleavedData[i * NumChannels + Channel] = InputData[i];
+                }
+            }
+
+            const int32 CurrentNumFilters = FMath::Clamp(*NumFilters, 1, MaxAllowedFilters);
+
+            AllPassChain.ProcessInPlace(InterleavedData, NumFrames, CurrentNumFilters);
+
+            for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+            {
+                float* OutputData = OutputSignals[Channel]->GetData();
+
+                for (int32 i = 0; i < NumFrames; ++i)
+                {
+                    OutputData[i] = InterleavedData[i * NumChannels + Channel];
+                }
+            }
+        }
+
+    private:
+        METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(TPhaseDisperserMultichannelOperator);
+
+        // Inputs
+        TArray<FAudioBufferReadRef> InputSignals;
+        FInt32ReadRef NumFilters;
+
+        // Outputs
+        TArray<FAudioBufferWriteRef> OutputSignals;
+
+        // Allpass filter stages, with state interleaved per channel
+        MetasoundBranches::TInterleavedAllPassChain<NumChannels> AllPassChain;
+
+        // Channels interleaved frame by frame for the duration of a block
+        TArray<float, TAlignedHeapAllocator<16>> Interleaved;
+    };
+
+    using FPhaseDisperserStereoOperator = TPhaseDisperserMultichannelOperator<2>;
+    using FPhaseDisperserQuadOperator = TPhaseDisperserMultichannelOperator<4>;
+
+    class FPhaseDisperserStereoNode : public FNodeFacade
+    {
+    public:
+        FPhaseDisperserStereoNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FPhaseDisperserStereoOperator>())
+        {
+        }
+    };
+
+    class FPhaseDisperserQuadNode : public FNodeFacade
+    {
+    public:
+        FPhaseDisperserQuadNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FPhaseDisperserQuadOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FPhaseDisperserStereoNode);
+    METASOUND_REGISTER_NODE(FPhaseDisperserQuadNode);
+}
+
+#undef LOCTEXT_NAMESPACE
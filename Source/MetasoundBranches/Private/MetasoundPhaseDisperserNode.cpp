@@ -1,23 +1,42 @@
 // Copyright 2025 Charles Matthews. All Rights Reserved.
 
 #include "MetasoundBranches/Public/MetasoundPhaseDisperserNode.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
+#include "MetasoundBranches/Private/MetasoundBranchesKernelDispatch.h"
+#include "MetasoundBranches/Private/DSP/AllPassChain.h"
+#include "MetasoundBranches/Private/DSP/DispersionProfiles.h"
 #include "MetasoundExecutableOperator.h"
 #include "MetasoundPrimitives.h"
 #include "MetasoundNodeRegistrationMacro.h"
 #include "MetasoundFacade.h"
+#include "MetasoundEnumRegistrationMacro.h"
 #include "MetasoundParamHelper.h"
 #include "Math/UnrealMathUtility.h"
 
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodes_PhaseDisperserNode"
 
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FPhaseDisperserOperator);
+
 namespace Metasound
 {
+    // Only this node uses the enum, so it is not exported
+    DECLARE_METASOUND_ENUM(MetasoundBranches::EDispersionProfile, MetasoundBranches::EDispersionProfile::Classic, ,
+        FEnumDispersionProfile, FEnumDispersionProfileInfo, FEnumDispersionProfileReadRef, FEnumDispersionProfileWriteRef);
+
+    DEFINE_METASOUND_ENUM_BEGIN(MetasoundBranches::EDispersionProfile, FEnumDispersionProfile, "DispersionProfile")
+        DEFINE_METASOUND_ENUM_ENTRY(MetasoundBranches::EDispersionProfile::Classic, "ClassicDescription", "Classic", "ClassicDescriptionTT", "A chain of identical allpass stages, set by Stages."),
+        DEFINE_METASOUND_ENUM_ENTRY(MetasoundBranches::EDispersionProfile::Smear, "SmearDescription", "Smear", "SmearDescriptionTT", "The classic chain's group delay, limited to the audible band."),
+        DEFINE_METASOUND_ENUM_ENTRY(MetasoundBranches::EDispersionProfile::Chirp, "ChirpDescription", "Chirp", "ChirpDescriptionTT", "Low frequencies delayed the most, falling away towards the top of the band."),
+        DEFINE_METASOUND_ENUM_ENTRY(MetasoundBranches::EDispersionProfile::Spring, "SpringDescription", "Spring", "SpringDescriptionTT", "Group delay rising up to ~4kHz and falling off above, like a spring tank.")
+    DEFINE_METASOUND_ENUM_END()
+
     namespace PhaseDisperserNodeNames
     {
         METASOUND_PARAM(InputSignal, "In", "Incoming audio.");
         METASOUND_PARAM(OutputSignal, "Out", "Phase-dispersed audio.");
 
-        METASOUND_PARAM(NumFilters, "Stages", "Number of allpass filter stages to apply (maximum 128).");
+        METASOUND_PARAM(NumFilters, "Stages", "Number of allpass filter stages to apply (maximum 128). Used by the Classic profile.");
+        METASOUND_PARAM(InputProfile, "Profile", "Dispersion profile: Classic (chain of Stages), Smear, Chirp or Spring.");
     }
 
     class FPhaseDisperserOperator : public TExecutableOperator<FPhaseDisperserOperator>
@@ -26,15 +45,26 @@ namespace Metasound
         // Maximum number of allowed allpass filters
         static constexpr int32 MaxAllowedFilters = 128;
 
-        FPhaseDisperserOperator(const FAudioBufferReadRef& InSignal, const TDataReadReference<int32>& InNumFilters)
+        using EDispersionProfile = MetasoundBranches::EDispersionProfile;
+        static constexpr int32 NumProfiles = static_cast<int32>(EDispersionProfile::Num);
+
+        FPhaseDisperserOperator(
+            const FOperatorSettings& InSettings,
+            const FAudioBufferReadRef& InSignal,
+            const TDataReadReference<int32>& InNumFilters,
+            const FEnumDispersionProfileReadRef& InProfile)
             : InputSignal(InSignal)
             , NumFilters(InNumFilters)
+            , InputProfile(InProfile)
             , OutputSignal(FAudioBufferWriteRef::CreateNew(InSignal->Num()))
         {
-            AllPassFilters.SetNum(MaxAllowedFilters);
-            for (int32 i = 0; i < MaxAllowedFilters; ++i)
+            AllPassChain.Init(MaxAllowedFilters, 0.5f, MetasoundBranches::GetOperatorSimdLevel());
+            SectionChain.Init(MetasoundBranches::FDispersionProfiles::NumSections);
+
+            // Shared tables, built on first use for this sample rate
+            for (int32 i = 0; i < NumProfiles; ++i)
             {
-                AllPassFilters[i].Init();
+                ProfileTables.Add(MetasoundBranches::FDispersionProfiles::Get(static_cast<EDispersionProfile>(i), InSettings.GetSampleRate()));
             }
         }
 
@@ -45,7 +75,8 @@ namespace Metasound
             static const FVertexInterface Interface(
                 FInputVertexInterface(
                     TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputSignal)),
-                    TInputDataVertex<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(NumFilters)) 
+                    TInputDataVertex<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(NumFilters)),
+                    TInputDataVertex<FEnumDispersionProfile>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputProfile), static_cast<int32>(EDispersionProfile::Classic))
                 ),
                 FOutputVertexInterface(
                     TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputSignal))
@@ -64,7 +95,7 @@ namespace Metasound
                 FNodeClassMetadata Metadata;
                 Metadata.ClassName = { TEXT("UE"), TEXT("PhaseDisperser"), TEXT("Audio") };
                 Metadata.MajorVersion = 1;
-                Metadata.MinorVersion = 0;
+                Metadata.MinorVersion = 1;
                 Metadata.DisplayName = METASOUND_LOCTEXT("PhaseDisperserNodeDisplayName", "Phase Disperser");
                 Metadata.Description = METASOUND_LOCTEXT("PhaseDisperserNodeDesc", "A chain of allpass filters acting as a phase disperser to soften transients.");
                 Metadata.Author = "Charles Matthews";
@@ -80,25 +111,20 @@ namespace Metasound
             return Metadata;
         }
 
-        virtual FDataReferenceCollection GetInputs() const override
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
         {
             using namespace PhaseDisperserNodeNames;
 
-            FDataReferenceCollection InputDataReferences;
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputSignal), InputSignal);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(NumFilters), NumFilters);
-
-            return InputDataReferences;
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputSignal), InputSignal);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(NumFilters), NumFilters);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputProfile), InputProfile);
         }
 
-        virtual FDataReferenceCollection GetOutputs() const override
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
         {
             using namespace PhaseDisperserNodeNames;
 
-            FDataReferenceCollection OutputDataReferences;
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputSignal), OutputSignal);
-
-            return OutputDataReferences;
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputSignal), OutputSignal);
         }
 
         static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
@@ -114,78 +140,77 @@ namespace Metasound
             TDataReadReference<int32> NumFiltersRef = InputData.GetOrCreateDefaultDataReadReference<int32>(
                 METASOUND_GET_PARAM_NAME(NumFilters), InParams.OperatorSettings);
 
+            FEnumDispersionProfileReadRef ProfileRef = InputData.GetOrCreateDefaultDataReadReference<FEnumDispersionProfile>(
+                METASOUND_GET_PARAM_NAME(InputProfile), InParams.OperatorSettings);
+
             int32 ClampedNumFilters = FMath::Clamp(*NumFiltersRef, 1, MaxAllowedFilters);
           
-            return MakeUnique<FPhaseDisperserOperator>(InputSignal, NumFiltersRef);
+            return MakeUnique<FPhaseDisperserOperator>(InParams.OperatorSettings, InputSignal, NumFiltersRef, ProfileRef);
         }
 
-        void Execute()
+        virtual void Reset(const IOperator::FResetParams& InParams)
         {
-            int32 NumFrames = InputSignal->Num();
-            const float* InputData = InputSignal->GetData();
-            float* OutputData = OutputSignal->GetData();
+            OutputSignal->Zero();
 
-            // Temporary buffer to hold intermediate results
-            TArray<float> TempBuffer;
-            TempBuffer.SetNumZeroed(NumFrames);
+            AllPassChain.Reset();
+            SectionChain.Reset();
+            CurrentProfile = EDispersionProfile::Classic;
+        }
 
-            // Initial copy of input to temp buffer
-            FMemory::Memcpy(TempBuffer.GetData(), InputData, NumFrames * sizeof(float));
+        void Execute()
+        {
+            METASOUNDBRANCHES_EXECUTE_SCOPE(FPhaseDisperserOperator);
 
-            int32 CurrentNumFilters = FMath::Clamp(*NumFilters, 1, MaxAllowedFilters);
+            const int32 NumFrames = InputSignal->Num();
+            const float* InputData = InputSignal->GetData();
+            float* OutputData = OutputSignal->GetData();
 
-            for (int32 i = 0; i < CurrentNumFilters; ++i)
+            // Filter directly in the output buffer; no intermediate storage is needed
+            if (OutputData != InputData)
             {
-                AllPassFilters[i].ProcessBuffer(TempBuffer.GetData(), NumFrames);
+                FMemory::Memcpy(OutputData, InputData, NumFrames * sizeof(float));
             }
 
-            FMemory::Memcpy(OutputData, TempBuffer.GetData(), NumFrames * sizeof(float));
-        }
+            const EDispersionProfile Profile = *InputProfile;
 
-    private:
-        class FAllPassFilter
-        {
-        public:
-            void Init(float InFeedback = 0.5f)
+            // Start from silence when switching between the classic chain and a fitted profile
+            if (Profile != CurrentProfile)
             {
-                DelayBuffer.SetNumZeroed(2); // For D = 1
-                WriteIndex = 0;
-                Feedback = InFeedback;
+                AllPassChain.Reset();
+                SectionChain.Reset();
+                CurrentProfile = Profile;
             }
 
-            void ProcessBuffer(float* InOutBuffer, int32 NumSamples)
+            if (Profile == EDispersionProfile::Classic)
             {
-                for (int32 i = 0; i < NumSamples; ++i)
-                {
-                    float InSample = InOutBuffer[i];
-                    float DelayedSample = DelayBuffer[WriteIndex];
-
-                    // Allpass difference equation: y[n] = -a * x[n] + x[n-D] + a * y[n-D]
-                    float OutSample = -Feedback * InSample + DelayedSample;
-                    DelayBuffer[WriteIndex] = InSample + Feedback * OutSample;
+                const int32 CurrentNumFilters = FMath::Clamp(*NumFilters, 1, MaxAllowedFilters);
 
-                    InOutBuffer[i] = OutSample;
-
-                    // Update write index for D = 1
-                    WriteIndex = (WriteIndex + 1) % 2;
-                }
+                AllPassChain.ProcessInPlace(OutputData, NumFrames, CurrentNumFilters);
+            }
+            else
+            {
+                SectionChain.ProcessInPlace(OutputData, NumFrames, *ProfileTables[static_cast<int32>(Profile)]);
             }
+        }
 
-        private:
-            TArray<float> DelayBuffer;
-            int32 WriteIndex;
-            float Feedback;
-        };
+    private:
+        METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(FPhaseDisperserOperator);
 
         // Inputs
         FAudioBufferReadRef InputSignal;
         FInt32ReadRef NumFilters;
+        FEnumDispersionProfileReadRef InputProfile;
 
         // Outputs
         FAudioBufferWriteRef OutputSignal;
 
-        // Allpass filters
-        TArray<FAllPassFilter> AllPassFilters;
+        // Allpass filter stages
+        MetasoundBranches::FAllPassChain AllPassChain;
+
+        // Second-order sections for the fitted dispersion profiles
+        MetasoundBranches::FAllPassSectionChain SectionChain;
+        TArray<TSharedRef<const MetasoundBranches::FAllPassSectionTable>> ProfileTables;
+        EDispersionProfile CurrentProfile = EDispersionProfile::Classic;
     };
 
     class FPhaseDisperserNode : public FNodeFacade
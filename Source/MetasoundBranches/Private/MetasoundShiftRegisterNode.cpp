@@ -1,6 +1,7 @@
 // Copyright 2025 Charles Matthews. All Rights Reserved.
 
 #include "MetasoundBranches/Public/MetasoundShiftRegisterNode.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
 #include "MetasoundExecutableOperator.h"     // TExecutableOperator class
 #include "MetasoundPrimitives.h"             // ReadRef and WriteRef descriptions for bool, int32, float, and string
 #include "MetasoundNodeRegistrationMacro.h"  // METASOUND_LOCTEXT and METASOUND_REGISTER_NODE macros
@@ -9,6 +10,8 @@
 
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodes_ShiftRegisterNode"
 
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FShiftRegisterOperator);
+
 namespace Metasound
 {
     namespace ShiftRegisterNodeNames
@@ -106,35 +109,27 @@ namespace Metasound
             return Metadata;
         }
 
-        virtual FDataReferenceCollection GetInputs() const override
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
         {
             using namespace ShiftRegisterNodeNames;
 
-            FDataReferenceCollection InputDataReferences;
-
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputSignal), InputSignal);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputTrigger), InputTrigger);
-
-            return InputDataReferences;
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputSignal), InputSignal);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputTrigger), InputTrigger);
         }
 
-        virtual FDataReferenceCollection GetOutputs() const override
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
         {
             using namespace ShiftRegisterNodeNames;
 
-            FDataReferenceCollection OutputDataReferences;
-            
-            OutputDataReferences.AddDataWriteReference(METASOUND_GET_PARAM_NAME(OutputTrigger), OutputTrigger);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputSignal1), OutputSignal1);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputSignal2), OutputSignal2);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputSignal3), OutputSignal3);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputSignal4), OutputSignal4);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputSignal5), OutputSignal5);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputSignal6), OutputSignal6);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputSignal7), OutputSignal7);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputSignal8), OutputSignal8);
-
-            return OutputDataReferences;
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputTrigger), OutputTrigger);
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputSignal1), OutputSignal1);
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputSignal2), OutputSignal2);
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputSignal3), OutputSignal3);
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputSignal4), OutputSignal4);
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputSignal5), OutputSignal5);
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputSignal6), OutputSignal6);
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputSignal7), OutputSignal7);
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputSignal8), OutputSignal8);
         }
 
         static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
@@ -154,8 +149,33 @@ namespace Metasound
             );
         }
 
+        virtual void Reset(const IOperator::FResetParams& InParams)
+        {
+            OutputTrigger->Reset();
+
+            ShiftedValue1 = 0.0f;
+            ShiftedValue2 = 0.0f;
+            ShiftedValue3 = 0.0f;
+            ShiftedValue4 = 0.0f;
+            ShiftedValue5 = 0.0f;
+            ShiftedValue6 = 0.0f;
+            ShiftedValue7 = 0.0f;
+            ShiftedValue8 = 0.0f;
+
+            *OutputSignal1 = 0.0f;
+            *OutputSignal2 = 0.0f;
+            *OutputSignal3 = 0.0f;
+            *OutputSignal4 = 0.0f;
+            *OutputSignal5 = 0.0f;
+            *OutputSignal6 = 0.0f;
+            *OutputSignal7 = 0.0f;
+            *OutputSignal8 = 0.0f;
+        }
+
         void Execute()
         {
+            METASOUNDBRANCHES_EXECUTE_SCOPE(FShiftRegisterOperator);
+
             OutputTrigger->AdvanceBlock();
             
             InputTrigger->ExecuteBlock(
@@ -194,6 +214,8 @@ namespace Metasound
         }
 
     private:
+        METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(FShiftRegisterOperator);
+
         FFloatReadRef InputSignal;
         FTriggerReadRef InputTrigger;
         
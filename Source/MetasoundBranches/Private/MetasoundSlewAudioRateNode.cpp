@@ -0,0 +1,183 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Public/MetasoundSlewAudioRateNode.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
+#include "MetasoundBranches/Private/DSP/OnePoleSmoother.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundFacade.h"
+#include "MetasoundParamHelper.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundSlewAudioRateNode"
+
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FSlewAudioRateOperator);
+
+namespace Metasound
+{
+    // Vertex Names - define the node's inputs and outputs here
+    namespace SlewAudioRateNodeNames
+    {
+        METASOUND_PARAM(InputSignal, "In", "Audio signal to smooth.");
+        METASOUND_PARAM(InputRiseTime, "Rise Time", "Rise time in seconds, per sample.");
+        METASOUND_PARAM(InputFallTime, "Fall Time", "Fall time in seconds, per sample.");
+
+        METASOUND_PARAM(OutputSignal, "Out", "Slew rate limited signal.");
+    }
+
+    // Operator Class - defines the way the node is described, created, and executed
+    class FSlewAudioRateOperator : public TExecutableOperator<FSlewAudioRateOperator>
+    {
+    public:
+        // Constructor
+        FSlewAudioRateOperator(
+            const FOperatorSettings& InSettings,
+            const FAudioBufferReadRef& InSignal,
+            const FAudioBufferReadRef& InRiseTime,
+            const FAudioBufferReadRef& InFallTime,
+            int32 InSampleRate)
+            : InputSignal(InSignal)
+            , InputRiseTime(InRiseTime)
+            , InputFallTime(InFallTime)
+            , OutputSignal(FAudioBufferWriteRef::CreateNew(InSettings))
+            , Smoother(MetasoundBranches::FSmootherAudioRateCoefficients(InSampleRate, InSettings.GetNumFramesPerBlock()))
+        {
+        }
+
+        // Helper function for constructing vertex interface
+        static const FVertexInterface& DeclareVertexInterface()
+        {
+            using namespace SlewAudioRateNodeNames;
+
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputSignal)),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputRiseTime)),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputFallTime))
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputSignal))
+                )
+            );
+
+            return Interface;
+        }
+
+        // Metadata about the node
+        static const FNodeClassMetadata& GetNodeInfo()
+        {
+            auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
+            {
+                FNodeClassMetadata Metadata;
+                Metadata.ClassName = { TEXT("UE"), TEXT("Slew (Audio Rate)"), TEXT("Audio") };
+                Metadata.MajorVersion = 1;
+                Metadata.MinorVersion = 0;
+                Metadata.DisplayName = METASOUND_LOCTEXT("SlewAudioRateDisplayName", "Slew (Audio Rate)");
+                Metadata.Description = METASOUND_LOCTEXT("SlewAudioRateDesc", "Smooth the rise and fall of an incoming signal, with rise and fall times modulated at audio rate.");
+                Metadata.Author = "Charles Matthews";
+                Metadata.PromptIfMissing = PluginNodeMissingPrompt;
+                Metadata.DefaultInterface = DeclareVertexInterface();
+                Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
+                Metadata.Keywords = TArray<FText>(); // Keywords for searching
+
+                return Metadata;
+            };
+
+            static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+            return Metadata;
+        }
+
+        // Input Data References
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
+        {
+            using namespace SlewAudioRateNodeNames;
+
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputSignal), InputSignal);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputRiseTime), InputRiseTime);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputFallTime), InputFallTime);
+        }
+
+        // Output Data References
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
+        {
+            using namespace SlewAudioRateNodeNames;
+
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputSignal), OutputSignal);
+        }
+
+        // Operator Factory Method
+        static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+        {
+            using namespace SlewAudioRateNodeNames;
+
+            const FInputVertexInterfaceData& InputData = InParams.InputData;
+            const FInputVertexInterface& InputInterface = DeclareVertexInterface().GetInputInterface();
+
+            // Retrieve input references or use default values
+            TDataReadReference<FAudioBuffer> InputSignal = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(
+                METASOUND_GET_PARAM_NAME(InputSignal),
+                InParams.OperatorSettings
+            );
+
+            TDataReadReference<FAudioBuffer> InputRiseTime = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(
+                METASOUND_GET_PARAM_NAME(InputRiseTime),
+                InParams.OperatorSettings
+            );
+
+            TDataReadReference<FAudioBuffer> InputFallTime = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(
+                METASOUND_GET_PARAM_NAME(InputFallTime),
+                InParams.OperatorSettings
+            );
+
+            int32 SampleRate = InParams.OperatorSettings.GetSampleRate();
+
+            return MakeUnique<FSlewAudioRateOperator>(InParams.OperatorSettings, InputSignal, InputRiseTime, InputFallTime, SampleRate);
+        }
+
+        virtual void Reset(const IOperator::FResetParams& InParams)
+        {
+            OutputSignal->Zero();
+            Smoother.Reset();
+        }
+
+        // Primary node functionality
+        virtual void Execute()
+        {
+            METASOUNDBRANCHES_EXECUTE_SCOPE(FSlewAudioRateOperator);
+
+            const int32 NumFrames = InputSignal->Num();
+
+            Smoother.GetCoefficients().Update(InputRiseTime->GetData(), InputFallTime->GetData(), NumFrames);
+            Smoother.Process(MetasoundBranches::FSmootherBufferInput{ InputSignal->GetData() }, OutputSignal->GetData(), NumFrames);
+        }
+
+    private:
+        METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(FSlewAudioRateOperator);
+
+        // Input References
+        FAudioBufferReadRef InputSignal;
+        FAudioBufferReadRef InputRiseTime;
+        FAudioBufferReadRef InputFallTime;
+
+        // Output Reference
+        FAudioBufferWriteRef OutputSignal;
+
+        // Smoother state and per-sample coefficients
+        MetasoundBranches::TOnePoleSmoother<MetasoundBranches::FSmootherAudioRateCoefficients> Smoother;
+    };
+
+    // Node Facade Class
+    class FSlewAudioRateNode : public FNodeFacade
+    {
+    public:
+        FSlewAudioRateNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FSlewAudioRateOperator>())
+        {
+        }
+    };
+
+    // Register the Node
+    METASOUND_REGISTER_NODE(FSlewAudioRateNode);
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -1,6 +1,8 @@
 // Copyright 2025 Charles Matthews. All Rights Reserved.
 
 #include "MetasoundBranches/Public/MetasoundSlewFloatNode.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
+#include "MetasoundBranches/Private/DSP/OnePoleSmoother.h"
 #include "MetasoundExecutableOperator.h"
 #include "MetasoundPrimitives.h"
 #include "MetasoundNodeRegistrationMacro.h"
@@ -9,6 +11,8 @@
 
 #define LOCTEXT_NAMESPACE "MetasoundSlewNode"
 
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FSlewFloatOperator);
+
 namespace Metasound
 {
     // Vertex Names - define the node's inputs and outputs here
@@ -36,8 +40,7 @@ namespace Metasound
             , InputRiseTime(InRiseTime)
             , InputFallTime(InFallTime)
             , OutputSignal(FFloatWriteRef::CreateNew(0.0f))
-            , PreviousOutputSample(0.0f)
-            , SampleRate(InSampleRate)
+            , Smoother(MetasoundBranches::FSmootherBlockCoefficients(InSampleRate))
         {
         }
 
@@ -85,27 +88,21 @@ namespace Metasound
         }
 
         // Input Data References
-        virtual FDataReferenceCollection GetInputs() const override
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
         {
             using namespace SlewFloatNodeNames;
 
-            FDataReferenceCollection InputDataReferences;
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputSignal), InputSignal);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputRiseTime), InputRiseTime);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputFallTime), InputFallTime);
-
-            return InputDataReferences;
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputSignal), InputSignal);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputRiseTime), InputRiseTime);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputFallTime), InputFallTime);
         }
 
         // Output Data References
-        virtual FDataReferenceCollection GetOutputs() const override
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
         {
             using namespace SlewFloatNodeNames;
 
-            FDataReferenceCollection OutputDataReferences;
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputSignal), OutputSignal);
-
-            return OutputDataReferences;
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputSignal), OutputSignal);
         }
 
         // Operator Factory Method
@@ -137,39 +134,25 @@ namespace Metasound
             return MakeUnique<FSlewFloatOperator>(InParams.OperatorSettings, InputSignal, InputRiseTime, InputFallTime, SampleRate);
         }
 
+        virtual void Reset(const IOperator::FResetParams& InParams)
+        {
+            *OutputSignal = 0.0f;
+            Smoother.Reset();
+        }
+
         // Primary node functionality
         virtual void Execute()
         {
-            float SignalSample = *InputSignal;
-
-            float RiseTimeSeconds = InputRiseTime->GetSeconds();
-            float FallTimeSeconds = InputFallTime->GetSeconds();
-
-            // Calculate alpha values based on rise and fall times
-            // Alpha = exp(-1 / (time * sample rate))
-            float RiseAlpha = (RiseTimeSeconds > 0.0f) ? FMath::Exp(-1.0f / (RiseTimeSeconds * SampleRate)) : 0.0f;
-            float FallAlpha = (FallTimeSeconds > 0.0f) ? FMath::Exp(-1.0f / (FallTimeSeconds * SampleRate)) : 0.0f;
+            METASOUNDBRANCHES_EXECUTE_SCOPE(FSlewFloatOperator);
 
-            float OutputSample = PreviousOutputSample;
-
-            if (SignalSample > PreviousOutputSample)
-            {
-                OutputSample = RiseAlpha * PreviousOutputSample + (1.0f - RiseAlpha) * SignalSample;
-            }
-            else if (SignalSample < PreviousOutputSample)
-            {
-                OutputSample = FallAlpha * PreviousOutputSample + (1.0f - FallAlpha) * SignalSample;
-            }
-            else
-            {
-                OutputSample = SignalSample;
-            }
-
-            *OutputSignal = OutputSample;
-            PreviousOutputSample = OutputSample;
+            // One step per block, so the time constants are in blocks
+            Smoother.GetCoefficients().Update(InputRiseTime->GetSeconds(), InputFallTime->GetSeconds());
+            *OutputSignal = Smoother.ProcessFrame(*InputSignal);
         }
 
     private:
+        METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(FSlewFloatOperator);
+
         // Input References
         FFloatReadRef InputSignal;
         FTimeReadRef InputRiseTime;
@@ -178,11 +161,8 @@ namespace Metasound
         // Output Reference
         FFloatWriteRef OutputSignal;
 
-        // State Variable
-        float PreviousOutputSample;
-
-        // Sample Rate
-        int32 SampleRate;
+        // Smoother state and cached coefficients
+        MetasoundBranches::TOnePoleSmoother<MetasoundBranches::FSmootherBlockCoefficients> Smoother;
     };
 
     // Node Facade Class
@@ -1,6 +1,8 @@
 // Copyright 2025 Charles Matthews. All Rights Reserved.
 
 #include "MetasoundBranches/Public/MetasoundSlewNode.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
+#include "MetasoundBranches/Private/DSP/OnePoleSmoother.h"
 #include "MetasoundExecutableOperator.h"
 #include "MetasoundPrimitives.h"
 #include "MetasoundNodeRegistrationMacro.h"
@@ -9,6 +11,8 @@
 
 #define LOCTEXT_NAMESPACE "MetasoundSlewNode"
 
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FSlewOperator);
+
 namespace Metasound
 {
     // Vertex Names - define the node's inputs and outputs here
@@ -36,8 +40,7 @@ namespace Metasound
             , InputRiseTime(InRiseTime)
             , InputFallTime(InFallTime)
             , OutputSignal(FAudioBufferWriteRef::CreateNew(InSettings))
-            , PreviousOutputSample(0.0f)
-            , SampleRate(InSampleRate)
+            , Smoother(MetasoundBranches::FSmootherBlockCoefficients(InSampleRate))
         {
         }
 
@@ -85,27 +88,21 @@ namespace Metasound
         }
 
         // Input Data References
-        virtual FDataReferenceCollection GetInputs() const override
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
         {
             using namespace SlewNodeNames;
 
-            FDataReferenceCollection InputDataReferences;
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputSignal), InputSignal);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputRiseTime), InputRiseTime);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputFallTime), InputFallTime);
-
-            return InputDataReferences;
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputSignal), InputSignal);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputRiseTime), InputRiseTime);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputFallTime), InputFallTime);
         }
 
         // Output Data References
-        virtual FDataReferenceCollection GetOutputs() const override
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
         {
             using namespace SlewNodeNames;
 
-            FDataReferenceCollection OutputDataReferences;
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputSignal), OutputSignal);
-
-            return OutputDataReferences;
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputSignal), OutputSignal);
         }
 
         // Operator Factory Method
@@ -137,46 +134,24 @@ namespace Metasound
             return MakeUnique<FSlewOperator>(InParams.OperatorSettings, InputSignal, InputRiseTime, InputFallTime, SampleRate);
         }
 
+        virtual void Reset(const IOperator::FResetParams& InParams)
+        {
+            OutputSignal->Zero();
+            Smoother.Reset();
+        }
+
         // Primary node functionality
         virtual void Execute()
         {
-            int32 NumFrames = InputSignal->Num();
+            METASOUNDBRANCHES_EXECUTE_SCOPE(FSlewOperator);
 
-            const float* SignalData = InputSignal->GetData();
-            float* OutputDataPtr = OutputSignal->GetData();
-
-            float RiseTimeSeconds = InputRiseTime->GetSeconds();
-            float FallTimeSeconds = InputFallTime->GetSeconds();
-
-            // Calculate alpha values based on rise and fall times
-            // Alpha = exp(-1 / (time * sample rate))
-            float RiseAlpha = (RiseTimeSeconds > 0.0f) ? FMath::Exp(-1.0f / (RiseTimeSeconds * SampleRate)) : 0.0f;
-            float FallAlpha = (FallTimeSeconds > 0.0f) ? FMath::Exp(-1.0f / (FallTimeSeconds * SampleRate)) : 0.0f;
-
-            for (int32 i = 0; i < NumFrames; ++i)
-            {
-                float SignalSample = SignalData[i];
-                float OutputSample = PreviousOutputSample;
-
-                if (SignalSample > PreviousOutputSample)
-                {
-                    OutputSample = RiseAlpha * PreviousOutputSample + (1.0f - RiseAlpha) * SignalSample;
-                }
-                else if (SignalSample < PreviousOutputSample)
-                {
-                    OutputSample = FallAlpha * PreviousOutputSample + (1.0f - FallAlpha) * SignalSample;
-                }
-                else
-                {
-                    OutputSample = SignalSample;
-                }
-
-                OutputDataPtr[i] = OutputSample;
-                PreviousOutputSample = OutputSample;
-            }
+            Smoother.GetCoefficients().Update(InputRiseTime->GetSeconds(), InputFallTime->GetSeconds());
+            Smoother.Process(MetasoundBranches::FSmootherBufferInput{ InputSignal->GetData() }, OutputSignal->GetData(), InputSignal->Num());
         }
 
     private:
+        METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(FSlewOperator);
+
         // Input References
         FAudioBufferReadRef InputSignal;
         FTimeReadRef InputRiseTime;
@@ -185,11 +160,8 @@ namespace Metasound
         // Output Reference
         FAudioBufferWriteRef OutputSignal;
 
-        // State Variable
-        float PreviousOutputSample;
-
-        // Sample Rate
-        int32 SampleRate;
+        // Smoother state and cached coefficients
+        MetasoundBranches::TOnePoleSmoother<MetasoundBranches::FSmootherBlockCoefficients> Smoother;
     };
 
     // Node Facade Class
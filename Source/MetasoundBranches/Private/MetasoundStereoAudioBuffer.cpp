@@ -0,0 +1,8 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Public/MetasoundStereoAudioBuffer.h"
+#include "MetasoundDataTypeRegistrationMacro.h"  // REGISTER_METASOUND_DATATYPE macro
+
+// Built from the operator settings only; there is no literal to set one from. Registered with the frontend
+// by the module's RegisterPendingNodes() call, along with the nodes.
+REGISTER_METASOUND_DATATYPE(Metasound::FStereoAudioBuffer, "StereoAudio");
@@ -0,0 +1,175 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Public/MetasoundStereoBalanceAudioRateNode.h"
+#include "MetasoundBranches/Private/MetasoundStereoMatrixOperator.h"
+#include "MetasoundBranches/Private/DSP/StereoModulation.h"
+#include "MetasoundNodeRegistrationMacro.h"  // METASOUND_LOCTEXT and METASOUND_REGISTER_NODE macros
+#include "MetasoundFacade.h"                 // FNodeFacade class, eliminates the need for a fair amount of boilerplate code
+#include "MetasoundParamHelper.h"            // METASOUND_PARAM and METASOUND_GET_PARAM family of macros
+
+#define LOCTEXT_NAMESPACE "MetasoundStereoBalanceAudioRateNode"
+
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FBalanceAudioRateOperator);
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FBalanceAudioRateStereoAudioOperator);
+
+namespace Metasound
+{
+    namespace BalanceAudioRateNodeNames
+    {
+        METASOUND_PARAM(InputLeftSignal, "In L", "Left channel audio input.");
+        METASOUND_PARAM(InputRightSignal, "In R", "Right channel audio input.");
+        METASOUND_PARAM(InputBalance, "Balance", "Balance signal ranging from -1.0 (full left) to 1.0 (full right), read per sample.");
+
+        METASOUND_PARAM(OutputLeftSignal, "Out L", "Left output channel.");
+        METASOUND_PARAM(OutputRightSignal, "Out R", "Right output channel.");
+
+        METASOUND_PARAM(InputStereoSignal, "In", "Stereo audio input.");
+        METASOUND_PARAM(OutputStereoSignal, "Out", "Stereo output.");
+    }
+
+    // The control inputs and the matrix they make, shared by the node's two overloads
+    struct FBalanceAudioRateControls
+    {
+        using FMatrix = MetasoundBranches::FStereoBalanceSignal;
+
+        explicit FBalanceAudioRateControls(const FBuildOperatorParams& InParams)
+            : InputBalance(InParams.InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(BalanceAudioRateNodeNames::InputBalance), InParams.OperatorSettings))
+        {
+        }
+
+        void BindInputs(FInputVertexInterfaceData& InVertexData)
+        {
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(BalanceAudioRateNodeNames::InputBalance), InputBalance);
+        }
+
+        FMatrix GetMatrix() const
+        {
+            return FMatrix{ InputBalance->GetData() };
+        }
+
+        FAudioBufferReadRef InputBalance;
+    };
+
+    struct FBalanceAudioRateKernel : FBalanceAudioRateControls
+    {
+        using FBalanceAudioRateControls::FBalanceAudioRateControls;
+
+        static const FVertexInterface& DeclareVertexInterface()
+        {
+            using namespace BalanceAudioRateNodeNames;
+
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputLeftSignal)),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputRightSignal)),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputBalance))
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputLeftSignal)),
+                    TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputRightSignal))
+                )
+            );
+
+            return Interface;
+        }
+
+        static FNodeClassMetadata CreateNodeClassMetadata()
+        {
+            FNodeClassMetadata Metadata;
+
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Balance (Audio Rate)"), TEXT("Audio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("BalanceAudioRateNodeDisplayName", "Stereo Balance (Audio Rate)");
+            Metadata.Description = METASOUND_LOCTEXT("BalanceAudioRateNodeDesc", "Adjusts the balance of a stereo signal from a balance signal, sample by sample.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
+
+            return Metadata;
+        }
+
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
+        {
+            using namespace BalanceAudioRateNodeNames;
+
+            return {
+                { METASOUND_GET_PARAM_NAME(InputLeftSignal), METASOUND_GET_PARAM_NAME(InputRightSignal) },
+                { METASOUND_GET_PARAM_NAME(OutputLeftSignal), METASOUND_GET_PARAM_NAME(OutputRightSignal) }
+            };
+        }
+
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FBalanceAudioRateOperator);
+    };
+
+    // The StereoAudio overload: the same node with one audio vertex per stereo pair
+    struct FBalanceAudioRateStereoAudioKernel : FBalanceAudioRateControls
+    {
+        using FBalanceAudioRateControls::FBalanceAudioRateControls;
+
+        static const FVertexInterface& DeclareVertexInterface()
+        {
+            using namespace BalanceAudioRateNodeNames;
+
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputStereoSignal)),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputBalance))
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputStereoSignal))
+                )
+            );
+
+            return Interface;
+        }
+
+        static FNodeClassMetadata CreateNodeClassMetadata()
+        {
+            FNodeClassMetadata Metadata;
+
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Balance (Audio Rate)"), TEXT("StereoAudio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("BalanceAudioRateStereoAudioNodeDisplayName", "Stereo Balance (Audio Rate, Stereo Audio)");
+            Metadata.Description = METASOUND_LOCTEXT("BalanceAudioRateStereoAudioNodeDesc", "Adjusts the balance of a stereo signal from a balance signal, sample by sample.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
+
+            return Metadata;
+        }
+
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
+        {
+            using namespace BalanceAudioRateNodeNames;
+
+            return { { METASOUND_GET_PARAM_NAME(InputStereoSignal) }, { METASOUND_GET_PARAM_NAME(OutputStereoSignal) } };
+        }
+
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FBalanceAudioRateStereoAudioOperator);
+    };
+
+    using FBalanceAudioRateOperator = TStereoMatrixOperator<FBalanceAudioRateKernel>;
+    using FBalanceAudioRateStereoAudioOperator = TStereoMatrixOperator<FBalanceAudioRateStereoAudioKernel, TStereoMatrixStereoVertices<FBalanceAudioRateStereoAudioKernel::FMatrix::NumInputs>>;
+
+    class FBalanceAudioRateNode : public FNodeFacade
+    {
+    public:
+        FBalanceAudioRateNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FBalanceAudioRateOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FBalanceAudioRateNode);
+
+    class FBalanceAudioRateStereoAudioNode : public FNodeFacade
+    {
+    public:
+        FBalanceAudioRateStereoAudioNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FBalanceAudioRateStereoAudioOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FBalanceAudioRateStereoAudioNode);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -1,15 +1,16 @@
 // Copyright 2025 Charles Matthews. All Rights Reserved.
 
 #include "MetasoundBranches/Public/MetasoundStereoBalanceNode.h"
-#include "MetasoundExecutableOperator.h"     // TExecutableOperator class
-#include "MetasoundPrimitives.h"             // ReadRef and WriteRef descriptions for bool, int32, float, and string
+#include "MetasoundBranches/Private/MetasoundStereoMatrixOperator.h"
 #include "MetasoundNodeRegistrationMacro.h"  // METASOUND_LOCTEXT and METASOUND_REGISTER_NODE macros
 #include "MetasoundFacade.h"                 // FNodeFacade class, eliminates the need for a fair amount of boilerplate code
 #include "MetasoundParamHelper.h"            // METASOUND_PARAM and METASOUND_GET_PARAM family of macros
-#include "Math/UnrealMathUtility.h"          // For FMath functions
 
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodes_BalanceNode"
 
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FBalanceOperator);
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FBalanceStereoAudioOperator);
+
 namespace Metasound
 {
     namespace BalanceNodeNames
@@ -20,24 +21,38 @@ namespace Metasound
 
         METASOUND_PARAM(OutputLeftSignal, "Out L", "Left output channel.");
         METASOUND_PARAM(OutputRightSignal, "Out R", "Right output channel.");
+
+        METASOUND_PARAM(InputStereoSignal, "In", "Stereo audio input.");
+        METASOUND_PARAM(OutputStereoSignal, "Out", "Stereo output.");
     }
 
-    class FBalanceOperator : public TExecutableOperator<FBalanceOperator>
+    // The control inputs and the matrix they make, shared by the node's two overloads
+    struct FBalanceControls
     {
-    public:
-        FBalanceOperator(
-            const FOperatorSettings& InSettings,
-            const FAudioBufferReadRef& InLeftSignal,
-            const FAudioBufferReadRef& InRightSignal,
-            const FFloatReadRef& InBalance)
-            : InputLeftSignal(InLeftSignal)
-            , InputRightSignal(InRightSignal)
-            , InputBalance(InBalance)
-            , OutputLeftSignal(FAudioBufferWriteRef::CreateNew(InSettings))
-            , OutputRightSignal(FAudioBufferWriteRef::CreateNew(InSettings))
+        using FMatrix = MetasoundBranches::FStereoMatrix;
+
+        explicit FBalanceControls(const FBuildOperatorParams& InParams)
+            : InputBalance(InParams.InputData.GetOrCreateDefaultDataReadReference<float>(METASOUND_GET_PARAM_NAME(BalanceNodeNames::InputBalance), InParams.OperatorSettings))
+        {
+        }
+
+        void BindInputs(FInputVertexInterfaceData& InVertexData)
         {
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(BalanceNodeNames::InputBalance), InputBalance);
         }
 
+        FMatrix GetMatrix() const
+        {
+            return FMatrix::Balance(*InputBalance);
+        }
+
+        FFloatReadRef InputBalance;
+    };
+
+    struct FBalanceKernel : FBalanceControls
+    {
+        using FBalanceControls::FBalanceControls;
+
         static const FVertexInterface& DeclareVertexInterface()
         {
             using namespace BalanceNodeNames;
@@ -57,106 +72,82 @@ namespace Metasound
             return Interface;
         }
 
-        static const FNodeClassMetadata& GetNodeInfo()
+        static FNodeClassMetadata CreateNodeClassMetadata()
         {
-            auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
-                {
-                    FVertexInterface NodeInterface = DeclareVertexInterface();
-
-                    FNodeClassMetadata Metadata;
-    
-                    Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Balance"), TEXT("Audio") };
-                    Metadata.MajorVersion = 1;
-                    Metadata.MinorVersion = 0;
-                    Metadata.DisplayName = METASOUND_LOCTEXT("StereoGainNodeDisplayName", "Stereo Balance");
-                    Metadata.Description = METASOUND_LOCTEXT("StereoGainNodeDesc", "Adjusts the balance of a stereo signal.");
-                    Metadata.Author = "Charles Matthews";
-                    Metadata.PromptIfMissing = PluginNodeMissingPrompt;
-                    Metadata.DefaultInterface = NodeInterface;
-                    Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
-                    Metadata.Keywords = TArray<FText>();
-
-                    return Metadata;
-                };
-
-            static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+            FNodeClassMetadata Metadata;
+
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Balance"), TEXT("Audio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("StereoGainNodeDisplayName", "Stereo Balance");
+            Metadata.Description = METASOUND_LOCTEXT("StereoGainNodeDesc", "Adjusts the balance of a stereo signal.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
+
             return Metadata;
         }
 
-        virtual FDataReferenceCollection GetInputs() const override
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
         {
             using namespace BalanceNodeNames;
 
-            FDataReferenceCollection InputDataReferences;
+            return {
+                { METASOUND_GET_PARAM_NAME(InputLeftSignal), METASOUND_GET_PARAM_NAME(InputRightSignal) },
+                { METASOUND_GET_PARAM_NAME(OutputLeftSignal), METASOUND_GET_PARAM_NAME(OutputRightSignal) }
+            };
+        }
 
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputLeftSignal), InputLeftSignal);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputRightSignal), InputRightSignal);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputBalance), InputBalance);
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FBalanceOperator);
+    };
 
-            return InputDataReferences;
-        }
+    // The StereoAudio overload: the same node with one audio vertex per stereo pair
+    struct FBalanceStereoAudioKernel : FBalanceControls
+    {
+        using FBalanceControls::FBalanceControls;
 
-        virtual FDataReferenceCollection GetOutputs() const override
+        static const FVertexInterface& DeclareVertexInterface()
         {
             using namespace BalanceNodeNames;
 
-            FDataReferenceCollection OutputDataReferences;
-
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputLeftSignal), OutputLeftSignal);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputRightSignal), OutputRightSignal);
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputStereoSignal)),
+                    TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputBalance), 0.0f) // Default balance is centered
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputStereoSignal))
+                )
+            );
 
-            return OutputDataReferences;
+            return Interface;
         }
 
-        static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+        static FNodeClassMetadata CreateNodeClassMetadata()
         {
-            using namespace BalanceNodeNames;
-
-            const FInputVertexInterfaceData& InputData = InParams.InputData;
-            const Metasound::FInputVertexInterface& InputInterface = DeclareVertexInterface().GetInputInterface();
+            FNodeClassMetadata Metadata;
 
-            TDataReadReference<FAudioBuffer> InputLeftSignal = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputLeftSignal), InParams.OperatorSettings);
-            TDataReadReference<FAudioBuffer> InputRightSignal = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputRightSignal), InParams.OperatorSettings);
-            TDataReadReference<float> InputBalance = InputData.GetOrCreateDefaultDataReadReference<float>(METASOUND_GET_PARAM_NAME(InputBalance), InParams.OperatorSettings);
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Balance"), TEXT("StereoAudio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("BalanceStereoAudioNodeDisplayName", "Stereo Balance (Stereo Audio)");
+            Metadata.Description = METASOUND_LOCTEXT("BalanceStereoAudioNodeDesc", "Adjusts the balance of a stereo signal.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
 
-            return MakeUnique<FBalanceOperator>(InParams.OperatorSettings, InputLeftSignal, InputRightSignal, InputBalance);
+            return Metadata;
         }
 
-    void Execute()
-    {
-        int32 NumFrames = InputLeftSignal->Num();
-
-        const float* LeftData = InputLeftSignal->GetData();
-        const float* RightData = InputRightSignal->GetData();
-        float* OutputLeftData = OutputLeftSignal->GetData();
-        float* OutputRightData = OutputRightSignal->GetData();
-
-        float Balance = FMath::Clamp(*InputBalance, -1.0f, 1.0f);
-
-        float Angle = (Balance + 1.0f) * (PI / 4.0f);
-
-        float LeftGain = FMath::Cos(Angle);
-        float RightGain = FMath::Sin(Angle);
-
-        for (int32 i = 0; i < NumFrames; ++i)
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
         {
-            OutputLeftData[i] = LeftData[i] * LeftGain;
-            OutputRightData[i] = RightData[i] * RightGain;
-        }
-    }
-
-    private:
+            using namespace BalanceNodeNames;
 
-        // Inputs
-        FAudioBufferReadRef InputLeftSignal;
-        FAudioBufferReadRef InputRightSignal;
-        FFloatReadRef InputBalance;
+            return { { METASOUND_GET_PARAM_NAME(InputStereoSignal) }, { METASOUND_GET_PARAM_NAME(OutputStereoSignal) } };
+        }
 
-        // Outputs
-        FAudioBufferWriteRef OutputLeftSignal;
-        FAudioBufferWriteRef OutputRightSignal;
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FBalanceStereoAudioOperator);
     };
 
+    using FBalanceOperator = TStereoMatrixOperator<FBalanceKernel>;
+    using FBalanceStereoAudioOperator = TStereoMatrixOperator<FBalanceStereoAudioKernel, TStereoMatrixStereoVertices<FBalanceStereoAudioKernel::FMatrix::NumInputs>>;
+
     class FBalanceNode : public FNodeFacade
     {
     public:
@@ -167,6 +158,17 @@ namespace Metasound
     };
 
     METASOUND_REGISTER_NODE(FBalanceNode);
+
+    class FBalanceStereoAudioNode : public FNodeFacade
+    {
+    public:
+        FBalanceStereoAudioNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FBalanceStereoAudioOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FBalanceStereoAudioNode);
 }
 
-#undef LOCTEXT_NAMESPACE
\ No newline at end of file
+#undef LOCTEXT_NAMESPACE
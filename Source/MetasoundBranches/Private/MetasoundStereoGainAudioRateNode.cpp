@@ -0,0 +1,175 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Public/MetasoundStereoGainAudioRateNode.h"
+#include "MetasoundBranches/Private/MetasoundStereoMatrixOperator.h"
+#include "MetasoundBranches/Private/DSP/StereoModulation.h"
+#include "MetasoundNodeRegistrationMacro.h"  // METASOUND_LOCTEXT and METASOUND_REGISTER_NODE macros
+#include "MetasoundFacade.h"                 // FNodeFacade class, eliminates the need for a fair amount of boilerplate code
+#include "MetasoundParamHelper.h"            // METASOUND_PARAM and METASOUND_GET_PARAM family of macros
+
+#define LOCTEXT_NAMESPACE "MetasoundStereoGainAudioRateNode"
+
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FStereoGainAudioRateOperator);
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FStereoGainAudioRateStereoAudioOperator);
+
+namespace Metasound
+{
+    namespace StereoGainAudioRateNodeNames
+    {
+        METASOUND_PARAM(InputLeftSignal, "In L", "Left channel audio input.");
+        METASOUND_PARAM(InputRightSignal, "In R", "Right channel audio input.");
+        METASOUND_PARAM(InputGain, "Gain (Lin)", "Gain signal (0.0 to 1.0), read per sample.");
+
+        METASOUND_PARAM(OutputLeftSignal, "Out L", "Left output channel.");
+        METASOUND_PARAM(OutputRightSignal, "Out R", "Right output channel.");
+
+        METASOUND_PARAM(InputStereoSignal, "In", "Stereo audio input.");
+        METASOUND_PARAM(OutputStereoSignal, "Out", "Stereo output.");
+    }
+
+    // The control inputs and the matrix they make, shared by the node's two overloads
+    struct FStereoGainAudioRateControls
+    {
+        using FMatrix = MetasoundBranches::FStereoGainSignal;
+
+        explicit FStereoGainAudioRateControls(const FBuildOperatorParams& InParams)
+            : InputGain(InParams.InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(StereoGainAudioRateNodeNames::InputGain), InParams.OperatorSettings))
+        {
+        }
+
+        void BindInputs(FInputVertexInterfaceData& InVertexData)
+        {
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(StereoGainAudioRateNodeNames::InputGain), InputGain);
+        }
+
+        FMatrix GetMatrix() const
+        {
+            return FMatrix{ InputGain->GetData() };
+        }
+
+        FAudioBufferReadRef InputGain;
+    };
+
+    struct FStereoGainAudioRateKernel : FStereoGainAudioRateControls
+    {
+        using FStereoGainAudioRateControls::FStereoGainAudioRateControls;
+
+        static const FVertexInterface& DeclareVertexInterface()
+        {
+            using namespace StereoGainAudioRateNodeNames;
+
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputLeftSignal)),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputRightSignal)),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputGain))
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputLeftSignal)),
+                    TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputRightSignal))
+                )
+            );
+
+            return Interface;
+        }
+
+        static FNodeClassMetadata CreateNodeClassMetadata()
+        {
+            FNodeClassMetadata Metadata;
+
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Gain (Audio Rate)"), TEXT("Audio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("StereoGainAudioRateNodeDisplayName", "Stereo Gain (Audio Rate)");
+            Metadata.Description = METASOUND_LOCTEXT("StereoGainAudioRateNodeDesc", "Scale a stereo input by a gain signal, sample by sample.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
+
+            return Metadata;
+        }
+
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
+        {
+            using namespace StereoGainAudioRateNodeNames;
+
+            return {
+                { METASOUND_GET_PARAM_NAME(InputLeftSignal), METASOUND_GET_PARAM_NAME(InputRightSignal) },
+                { METASOUND_GET_PARAM_NAME(OutputLeftSignal), METASOUND_GET_PARAM_NAME(OutputRightSignal) }
+            };
+        }
+
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FStereoGainAudioRateOperator);
+    };
+
+    // The StereoAudio overload: the same node with one audio vertex per stereo pair
+    struct FStereoGainAudioRateStereoAudioKernel : FStereoGainAudioRateControls
+    {
+        using FStereoGainAudioRateControls::FStereoGainAudioRateControls;
+
+        static const FVertexInterface& DeclareVertexInterface()
+        {
+            using namespace StereoGainAudioRateNodeNames;
+
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputStereoSignal)),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputGain))
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputStereoSignal))
+                )
+            );
+
+            return Interface;
+        }
+
+        static FNodeClassMetadata CreateNodeClassMetadata()
+        {
+            FNodeClassMetadata Metadata;
+
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Gain (Audio Rate)"), TEXT("StereoAudio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("StereoGainAudioRateStereoAudioNodeDisplayName", "Stereo Gain (Audio Rate, Stereo Audio)");
+            Metadata.Description = METASOUND_LOCTEXT("StereoGainAudioRateStereoAudioNodeDesc", "Scale a stereo input by a gain signal, sample by sample.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
+
+            return Metadata;
+        }
+
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
+        {
+            using namespace StereoGainAudioRateNodeNames;
+
+            return { { METASOUND_GET_PARAM_NAME(InputStereoSignal) }, { METASOUND_GET_PARAM_NAME(OutputStereoSignal) } };
+        }
+
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FStereoGainAudioRateStereoAudioOperator);
+    };
+
+    using FStereoGainAudioRateOperator = TStereoMatrixOperator<FStereoGainAudioRateKernel>;
+    using FStereoGainAudioRateStereoAudioOperator = TStereoMatrixOperator<FStereoGainAudioRateStereoAudioKernel, TStereoMatrixStereoVertices<FStereoGainAudioRateStereoAudioKernel::FMatrix::NumInputs>>;
+
+    class FStereoGainAudioRateNode : public FNodeFacade
+    {
+    public:
+        FStereoGainAudioRateNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FStereoGainAudioRateOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FStereoGainAudioRateNode);
+
+    class FStereoGainAudioRateStereoAudioNode : public FNodeFacade
+    {
+    public:
+        FStereoGainAudioRateStereoAudioNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FStereoGainAudioRateStereoAudioOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FStereoGainAudioRateStereoAudioNode);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -1,14 +1,16 @@
 // Copyright 2025 Charles Matthews. All Rights Reserved.
 
 #include "MetasoundBranches/Public/MetasoundStereoGainNode.h"
-#include "MetasoundExecutableOperator.h"     // TExecutableOperator class
-#include "MetasoundPrimitives.h"             // ReadRef and WriteRef descriptions for bool, int32, float, and string
+#include "MetasoundBranches/Private/MetasoundStereoMatrixOperator.h"
 #include "MetasoundNodeRegistrationMacro.h"  // METASOUND_LOCTEXT and METASOUND_REGISTER_NODE macros
-#include "MetasoundFacade.h"                 // FNodeFacade class
+#include "MetasoundFacade.h"                 // FNodeFacade class, eliminates the need for a fair amount of boilerplate code
 #include "MetasoundParamHelper.h"            // METASOUND_PARAM and METASOUND_GET_PARAM family of macros
 
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodes_StereoGain"
 
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FStereoGainOperator);
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FStereoGainStereoAudioOperator);
+
 namespace Metasound
 {
     namespace StereoGainNodeNames
@@ -19,24 +21,38 @@ namespace Metasound
 
         METASOUND_PARAM(OutputLeftSignal, "Out L", "Left output channel.");
         METASOUND_PARAM(OutputRightSignal, "Out R", "Right output channel.");
+
+        METASOUND_PARAM(InputStereoSignal, "In", "Stereo audio input.");
+        METASOUND_PARAM(OutputStereoSignal, "Out", "Stereo output.");
     }
 
-    class FStereoGainOperator : public TExecutableOperator<FStereoGainOperator>
+    // The control inputs and the matrix they make, shared by the node's two overloads
+    struct FStereoGainControls
     {
-    public:
-        FStereoGainOperator(
-            const FOperatorSettings& InSettings,
-            const FAudioBufferReadRef& InLeftSignal,
-            const FAudioBufferReadRef& InRightSignal,
-            const FFloatReadRef& InGain)
-            : InputLeftSignal(InLeftSignal)
-            , InputRightSignal(InRightSignal)
-            , InputGain(InGain)
-            , OutputLeftSignal(FAudioBufferWriteRef::CreateNew(InSettings))
-            , OutputRightSignal(FAudioBufferWriteRef::CreateNew(InSettings))
+        using FMatrix = MetasoundBranches::FStereoMatrix;
+
+        explicit FStereoGainControls(const FBuildOperatorParams& InParams)
+            : InputGain(InParams.InputData.GetOrCreateDefaultDataReadReference<float>(METASOUND_GET_PARAM_NAME(StereoGainNodeNames::InputGain), InParams.OperatorSettings))
+        {
+        }
+
+        void BindInputs(FInputVertexInterfaceData& InVertexData)
         {
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(StereoGainNodeNames::InputGain), InputGain);
         }
 
+        FMatrix GetMatrix() const
+        {
+            return FMatrix::Gain(*InputGain);
+        }
+
+        FFloatReadRef InputGain;
+    };
+
+    struct FStereoGainKernel : FStereoGainControls
+    {
+        using FStereoGainControls::FStereoGainControls;
+
         static const FVertexInterface& DeclareVertexInterface()
         {
             using namespace StereoGainNodeNames;
@@ -56,96 +72,82 @@ namespace Metasound
             return Interface;
         }
 
-        static const FNodeClassMetadata& GetNodeInfo()
+        static FNodeClassMetadata CreateNodeClassMetadata()
         {
-            auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
-            {
-                FVertexInterface NodeInterface = DeclareVertexInterface();
-
-                FNodeClassMetadata Metadata;
-                Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Gain"), TEXT("Audio") };
-                Metadata.MajorVersion = 1;
-                Metadata.MinorVersion = 0;
-                Metadata.DisplayName = METASOUND_LOCTEXT("StereoGainNodeDisplayName", "Stereo Gain");
-                Metadata.Description = METASOUND_LOCTEXT("StereoGainNodeDesc", "Scale a stereo input to a gain value.");
-                Metadata.Author = "Charles Matthews";
-                Metadata.PromptIfMissing = PluginNodeMissingPrompt;
-                Metadata.DefaultInterface = NodeInterface;
-                Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
-                Metadata.Keywords = TArray<FText>();
-
-                return Metadata;
-            };
+            FNodeClassMetadata Metadata;
+
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Gain"), TEXT("Audio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("StereoGainNodeDisplayName", "Stereo Gain");
+            Metadata.Description = METASOUND_LOCTEXT("StereoGainNodeDesc", "Scale a stereo input to a gain value.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
 
-            static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
             return Metadata;
         }
 
-        virtual FDataReferenceCollection GetInputs() const override
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
         {
             using namespace StereoGainNodeNames;
 
-            FDataReferenceCollection InputDataReferences;
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputLeftSignal), InputLeftSignal);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputRightSignal), InputRightSignal);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputGain), InputGain);
-
-            return InputDataReferences;
+            return {
+                { METASOUND_GET_PARAM_NAME(InputLeftSignal), METASOUND_GET_PARAM_NAME(InputRightSignal) },
+                { METASOUND_GET_PARAM_NAME(OutputLeftSignal), METASOUND_GET_PARAM_NAME(OutputRightSignal) }
+            };
         }
 
-        virtual FDataReferenceCollection GetOutputs() const override
-        {
-            using namespace StereoGainNodeNames;
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FStereoGainOperator);
+    };
 
-            FDataReferenceCollection OutputDataReferences;
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputLeftSignal), OutputLeftSignal);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputRightSignal), OutputRightSignal);
-            return OutputDataReferences;
-        }
+    // The StereoAudio overload: the same node with one audio vertex per stereo pair
+    struct FStereoGainStereoAudioKernel : FStereoGainControls
+    {
+        using FStereoGainControls::FStereoGainControls;
 
-        static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+        static const FVertexInterface& DeclareVertexInterface()
         {
             using namespace StereoGainNodeNames;
 
-            const FInputVertexInterfaceData& InputData = InParams.InputData;
-            const Metasound::FInputVertexInterface& InputInterface = DeclareVertexInterface().GetInputInterface();
-
-            TDataReadReference<FAudioBuffer> InputLeftSignal = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputLeftSignal), InParams.OperatorSettings);
-            TDataReadReference<FAudioBuffer> InputRightSignal = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputRightSignal), InParams.OperatorSettings);
-            TDataReadReference<float> Gain = InputData.GetOrCreateDefaultDataReadReference<float>(METASOUND_GET_PARAM_NAME(InputGain), InParams.OperatorSettings);
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputStereoSignal)),
+                    TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputGain), 1.0f)
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputStereoSignal))
+                )
+            );
 
-            return MakeUnique<FStereoGainOperator>(InParams.OperatorSettings, InputLeftSignal, InputRightSignal, Gain);
+            return Interface;
         }
 
-        void Execute()
+        static FNodeClassMetadata CreateNodeClassMetadata()
         {
-            const int32 NumFrames = InputLeftSignal->Num();
+            FNodeClassMetadata Metadata;
 
-            const float* LeftData = InputLeftSignal->GetData();
-            const float* RightData = InputRightSignal->GetData();
-            float* OutputLeftData = OutputLeftSignal->GetData();
-            float* OutputRightData = OutputRightSignal->GetData();
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Gain"), TEXT("StereoAudio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("StereoGainStereoAudioNodeDisplayName", "Stereo Gain (Stereo Audio)");
+            Metadata.Description = METASOUND_LOCTEXT("StereoGainStereoAudioNodeDesc", "Scale a stereo input to a gain value.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
 
-            const float GainVal = *InputGain;
-
-            for (int32 i = 0; i < NumFrames; ++i)
-            {
-                OutputLeftData[i] = LeftData[i] * GainVal;
-                OutputRightData[i] = RightData[i] * GainVal;
-            }
+            return Metadata;
         }
 
-    private:
-        // Inputs
-        FAudioBufferReadRef InputLeftSignal;
-        FAudioBufferReadRef InputRightSignal;
-        FFloatReadRef InputGain;
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
+        {
+            using namespace StereoGainNodeNames;
+
+            return { { METASOUND_GET_PARAM_NAME(InputStereoSignal) }, { METASOUND_GET_PARAM_NAME(OutputStereoSignal) } };
+        }
 
-        // Outputs
-        FAudioBufferWriteRef OutputLeftSignal;
-        FAudioBufferWriteRef OutputRightSignal;
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FStereoGainStereoAudioOperator);
     };
 
+    using FStereoGainOperator = TStereoMatrixOperator<FStereoGainKernel>;
+    using FStereoGainStereoAudioOperator = TStereoMatrixOperator<FStereoGainStereoAudioKernel, TStereoMatrixStereoVertices<FStereoGainStereoAudioKernel::FMatrix::NumInputs>>;
+
     class FStereoGainNode : public FNodeFacade
     {
     public:
@@ -156,6 +158,17 @@ namespace Metasound
     };
 
     METASOUND_REGISTER_NODE(FStereoGainNode);
+
+    class FStereoGainStereoAudioNode : public FNodeFacade
+    {
+    public:
+        FStereoGainStereoAudioNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FStereoGainStereoAudioOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FStereoGainStereoAudioNode);
 }
 
-#undef LOCTEXT_NAMESPACE
\ No newline at end of file
+#undef LOCTEXT_NAMESPACE
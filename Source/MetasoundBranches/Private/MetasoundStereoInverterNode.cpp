@@ -1,14 +1,16 @@
 // Copyright 2025 Charles Matthews. All Rights Reserved.
 
 #include "MetasoundBranches/Public/MetasoundStereoInverterNode.h"
-#include "MetasoundExecutableOperator.h"     // TExecutableOperator class
-#include "MetasoundPrimitives.h"             // ReadRef and WriteRef descriptions for bool, int32, float, and string
+#include "MetasoundBranches/Private/MetasoundStereoMatrixOperator.h"
 #include "MetasoundNodeRegistrationMacro.h"  // METASOUND_LOCTEXT and METASOUND_REGISTER_NODE macros
 #include "MetasoundFacade.h"                 // FNodeFacade class
 #include "MetasoundParamHelper.h"            // METASOUND_PARAM and METASOUND_GET_PARAM family of macros
 
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodes_StereoInverter"
 
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FStereoInverterOperator);
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FStereoInverterStereoAudioOperator);
+
 namespace Metasound
 {
     namespace StereoInverterNodeNames
@@ -21,28 +23,44 @@ namespace Metasound
 
         METASOUND_PARAM(OutputLeftSignal, "Out L", "Left output channel.");
         METASOUND_PARAM(OutputRightSignal, "Out R", "Right output channel.");
+
+        METASOUND_PARAM(InputStereoSignal, "In", "Stereo audio input.");
+        METASOUND_PARAM(OutputStereoSignal, "Out", "Stereo output.");
     }
 
-    class FStereoInverterOperator : public TExecutableOperator<FStereoInverterOperator>
+    // The control inputs and the matrix they make, shared by the node's two overloads
+    struct FStereoInverterControls
     {
-    public:
-        FStereoInverterOperator(
-            const FOperatorSettings& InSettings,
-            const FAudioBufferReadRef& InLeftSignal,
-            const FAudioBufferReadRef& InRightSignal,
-            const FBoolReadRef& InInvertLeft,
-            const FBoolReadRef& InInvertRight,
-            const FBoolReadRef& InSwapChannels)
-            : InputLeftSignal(InLeftSignal)
-            , InputRightSignal(InRightSignal)
-            , InputInvertLeft(InInvertLeft)
-            , InputInvertRight(InInvertRight)
-            , InputSwapChannels(InSwapChannels)
-            , OutputLeftSignal(FAudioBufferWriteRef::CreateNew(InSettings))
-            , OutputRightSignal(FAudioBufferWriteRef::CreateNew(InSettings))
+        using FMatrix = MetasoundBranches::FStereoMatrix;
+
+        explicit FStereoInverterControls(const FBuildOperatorParams& InParams)
+            : InputInvertLeft(InParams.InputData.GetOrCreateDefaultDataReadReference<bool>(METASOUND_GET_PARAM_NAME(StereoInverterNodeNames::InputInvertLeft), InParams.OperatorSettings))
+            , InputInvertRight(InParams.InputData.GetOrCreateDefaultDataReadReference<bool>(METASOUND_GET_PARAM_NAME(StereoInverterNodeNames::InputInvertRight), InParams.OperatorSettings))
+            , InputSwapChannels(InParams.InputData.GetOrCreateDefaultDataReadReference<bool>(METASOUND_GET_PARAM_NAME(StereoInverterNodeNames::InputSwapChannels), InParams.OperatorSettings))
+        {
+        }
+
+        void BindInputs(FInputVertexInterfaceData& InVertexData)
         {
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(StereoInverterNodeNames::InputInvertLeft), InputInvertLeft);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(StereoInverterNodeNames::InputInvertRight), InputInvertRight);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(StereoInverterNodeNames::InputSwapChannels), InputSwapChannels);
         }
 
+        FMatrix GetMatrix() const
+        {
+            return FMatrix::Inverter(*InputInvertLeft, *InputInvertRight, *InputSwapChannels);
+        }
+
+        FBoolReadRef InputInvertLeft;
+        FBoolReadRef InputInvertRight;
+        FBoolReadRef InputSwapChannels;
+    };
+
+    struct FStereoInverterKernel : FStereoInverterControls
+    {
+        using FStereoInverterControls::FStereoInverterControls;
+
         static const FVertexInterface& DeclareVertexInterface()
         {
             using namespace StereoInverterNodeNames;
@@ -64,119 +82,84 @@ namespace Metasound
             return Interface;
         }
 
-        static const FNodeClassMetadata& GetNodeInfo()
+        static FNodeClassMetadata CreateNodeClassMetadata()
         {
-            auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
-            {
-                FVertexInterface NodeInterface = DeclareVertexInterface();
-
-                FNodeClassMetadata Metadata;
-                Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Inverter"), TEXT("Audio") };
-                Metadata.MajorVersion = 1;
-                Metadata.MinorVersion = 0;
-                Metadata.DisplayName = METASOUND_LOCTEXT("StereoInverterNodeDisplayName", "Stereo Inverter");
-                Metadata.Description = METASOUND_LOCTEXT("StereoInverterNodeDesc", "Inverts and/or swaps stereo channels.");
-                Metadata.Author = "Charles Matthews";
-                Metadata.PromptIfMissing = PluginNodeMissingPrompt;
-                Metadata.DefaultInterface = NodeInterface;
-                Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
-                Metadata.Keywords = TArray<FText>();
-
-                return Metadata;
-            };
+            FNodeClassMetadata Metadata;
+
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Inverter"), TEXT("Audio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("StereoInverterNodeDisplayName", "Stereo Inverter");
+            Metadata.Description = METASOUND_LOCTEXT("StereoInverterNodeDesc", "Inverts and/or swaps stereo channels.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
 
-            static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
             return Metadata;
         }
 
-        virtual FDataReferenceCollection GetInputs() const override
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
         {
             using namespace StereoInverterNodeNames;
 
-            FDataReferenceCollection InputDataReferences;
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputLeftSignal), InputLeftSignal);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputRightSignal), InputRightSignal);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputInvertLeft), InputInvertLeft);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputInvertRight), InputInvertRight);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputSwapChannels), InputSwapChannels);
-
-            return InputDataReferences;
+            return {
+                { METASOUND_GET_PARAM_NAME(InputLeftSignal), METASOUND_GET_PARAM_NAME(InputRightSignal) },
+                { METASOUND_GET_PARAM_NAME(OutputLeftSignal), METASOUND_GET_PARAM_NAME(OutputRightSignal) }
+            };
         }
 
-        virtual FDataReferenceCollection GetOutputs() const override
-        {
-            using namespace StereoInverterNodeNames;
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FStereoInverterOperator);
+    };
 
-            FDataReferenceCollection OutputDataReferences;
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputLeftSignal), OutputLeftSignal);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputRightSignal), OutputRightSignal);
-            return OutputDataReferences;
-        }
+    // The StereoAudio overload: the same node with one audio vertex per stereo pair
+    struct FStereoInverterStereoAudioKernel : FStereoInverterControls
+    {
+        using FStereoInverterControls::FStereoInverterControls;
 
-        static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+        static const FVertexInterface& DeclareVertexInterface()
         {
             using namespace StereoInverterNodeNames;
 
-            const FInputVertexInterfaceData& InputData = InParams.InputData;
-            const Metasound::FInputVertexInterface& InputInterface = DeclareVertexInterface().GetInputInterface();
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputStereoSignal)),
+                    TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputInvertLeft), false),
+                    TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputInvertRight), false),
+                    TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputSwapChannels), false)
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputStereoSignal))
+                )
+            );
 
-            TDataReadReference<FAudioBuffer> InputLeftSignal = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputLeftSignal), InParams.OperatorSettings);
-            TDataReadReference<FAudioBuffer> InputRightSignal = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputRightSignal), InParams.OperatorSettings);
+            return Interface;
+        }
 
-            TDataReadReference<bool> InvertLeft = InputData.GetOrCreateDefaultDataReadReference<bool>(METASOUND_GET_PARAM_NAME(InputInvertLeft), InParams.OperatorSettings);
-            TDataReadReference<bool> InvertRight = InputData.GetOrCreateDefaultDataReadReference<bool>(METASOUND_GET_PARAM_NAME(InputInvertRight), InParams.OperatorSettings);
-            TDataReadReference<bool> SwapChannels = InputData.GetOrCreateDefaultDataReadReference<bool>(METASOUND_GET_PARAM_NAME(InputSwapChannels), InParams.OperatorSettings);
+        static FNodeClassMetadata CreateNodeClassMetadata()
+        {
+            FNodeClassMetadata Metadata;
 
-            return MakeUnique<FStereoInverterOperator>(InParams.OperatorSettings, InputLeftSignal, InputRightSignal, InvertLeft, InvertRight, SwapChannels);
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Inverter"), TEXT("StereoAudio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("StereoInverterStereoAudioNodeDisplayName", "Stereo Inverter (Stereo Audio)");
+            Metadata.Description = METASOUND_LOCTEXT("StereoInverterStereoAudioNodeDesc", "Inverts and/or swaps stereo channels.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
+
+            return Metadata;
         }
 
-        void Execute()
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
         {
-            const int32 NumFrames = InputLeftSignal->Num();
-
-            const float* LeftData = InputLeftSignal->GetData();
-            const float* RightData = InputRightSignal->GetData();
-            float* OutputLeftData = OutputLeftSignal->GetData();
-            float* OutputRightData = OutputRightSignal->GetData();
-
-            const bool bInvertL = *InputInvertLeft;
-            const bool bInvertR = *InputInvertRight;
-            const bool bSwap = *InputSwapChannels;
-
-            const float LMult = bInvertL ? -1.0f : 1.0f;
-            const float RMult = bInvertR ? -1.0f : 1.0f;
-
-            for (int32 i = 0; i < NumFrames; ++i)
-            {
-                const float LIn = LeftData[i];
-                const float RIn = RightData[i];
-
-                if (bSwap)
-                {
-                    OutputLeftData[i] = RIn * LMult;
-                    OutputRightData[i] = LIn * RMult;
-                }
-                else
-                {
-                    OutputLeftData[i] = LIn * LMult;
-                    OutputRightData[i] = RIn * RMult;
-                }
-            }
-        }
+            using namespace StereoInverterNodeNames;
 
-    private:
-        // Inputs
-        FAudioBufferReadRef InputLeftSignal;
-        FAudioBufferReadRef InputRightSignal;
-        FBoolReadRef InputInvertLeft;
-        FBoolReadRef InputInvertRight;
-        FBoolReadRef InputSwapChannels;
+            return { { METASOUND_GET_PARAM_NAME(InputStereoSignal) }, { METASOUND_GET_PARAM_NAME(OutputStereoSignal) } };
+        }
 
-        // Outputs
-        FAudioBufferWriteRef OutputLeftSignal;
-        FAudioBufferWriteRef OutputRightSignal;
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FStereoInverterStereoAudioOperator);
     };
 
+    using FStereoInverterOperator = TStereoMatrixOperator<FStereoInverterKernel>;
+    using FStereoInverterStereoAudioOperator = TStereoMatrixOperator<FStereoInverterStereoAudioKernel, TStereoMatrixStereoVertices<FStereoInverterStereoAudioKernel::FMatrix::NumInputs>>;
+
     class FStereoInverterNode : public FNodeFacade
     {
     public:
@@ -187,6 +170,17 @@ namespace Metasound
     };
 
     METASOUND_REGISTER_NODE(FStereoInverterNode);
+
+    class FStereoInverterStereoAudioNode : public FNodeFacade
+    {
+    public:
+        FStereoInverterStereoAudioNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FStereoInverterStereoAudioOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FStereoInverterStereoAudioNode);
 }
 
-#undef LOCTEXT_NAMESPACE
\ No newline at end of file
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,149 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Public/MetasoundStereoJoinNode.h"
+#include "MetasoundBranches/Public/MetasoundStereoAudioBuffer.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundFacade.h"
+#include "MetasoundParamHelper.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStereoJoinNode"
+
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FStereoJoinOperator);
+
+namespace Metasound
+{
+    namespace StereoJoinNodeNames
+    {
+        METASOUND_PARAM(InputLeftSignal, "In L", "Left channel audio input.");
+        METASOUND_PARAM(InputRightSignal, "In R", "Right channel audio input.");
+        METASOUND_PARAM(OutputSignal, "Out", "Both channels as one stereo audio value.");
+    }
+
+    class FStereoJoinOperator : public TExecutableOperator<FStereoJoinOperator>
+    {
+    public:
+        FStereoJoinOperator(
+            const FOperatorSettings& InSettings,
+            const FAudioBufferReadRef& InLeftSignal,
+            const FAudioBufferReadRef& InRightSignal)
+            : InputLeftSignal(InLeftSignal)
+            , InputRightSignal(InRightSignal)
+            , OutputSignal(FStereoAudioBufferWriteRef::CreateNew(InLeftSignal, InRightSignal))
+        {
+        }
+
+        static const FVertexInterface& DeclareVertexInterface()
+        {
+            using namespace StereoJoinNodeNames;
+
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputLeftSignal)),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputRightSignal))
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputSignal))
+                )
+            );
+
+            return Interface;
+        }
+
+        static const FNodeClassMetadata& GetNodeInfo()
+        {
+            auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
+            {
+                FNodeClassMetadata Metadata;
+                Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Join"), TEXT("StereoAudio") };
+                Metadata.MajorVersion = 1;
+                Metadata.MinorVersion = 0;
+                Metadata.DisplayName = METASOUND_LOCTEXT("StereoJoinDisplayName", "Stereo Join");
+                Metadata.Description = METASOUND_LOCTEXT("StereoJoinDesc", "Combines left and right audio into one stereo audio value.");
+                Metadata.Author = "Charles Matthews";
+                Metadata.PromptIfMissing = PluginNodeMissingPrompt;
+                Metadata.DefaultInterface = DeclareVertexInterface();
+                Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
+                Metadata.Keywords = TArray<FText>();
+
+                return Metadata;
+            };
+
+            static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+            return Metadata;
+        }
+
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
+        {
+            using namespace StereoJoinNodeNames;
+
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputLeftSignal), InputLeftSignal);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputRightSignal), InputRightSignal);
+
+            // The output wraps the inputs, so it is rebuilt when they change; BindOutputs then hands the new value on
+            if (&OutputSignal->GetLeft() != &*InputLeftSignal || &OutputSignal->GetRight() != &*InputRightSignal)
+            {
+                OutputSignal = FStereoAudioBufferWriteRef::CreateNew(InputLeftSignal, InputRightSignal);
+            }
+        }
+
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
+        {
+            using namespace StereoJoinNodeNames;
+
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputSignal), OutputSignal);
+        }
+
+        static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+        {
+            using namespace StereoJoinNodeNames;
+
+            const FInputVertexInterfaceData& InputData = InParams.InputData;
+
+            FAudioBufferReadRef InputLeftSignal = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(
+                METASOUND_GET_PARAM_NAME(InputLeftSignal),
+                InParams.OperatorSettings
+            );
+
+            FAudioBufferReadRef InputRightSignal = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(
+                METASOUND_GET_PARAM_NAME(InputRightSignal),
+                InParams.OperatorSettings
+            );
+
+            return MakeUnique<FStereoJoinOperator>(InParams.OperatorSettings, InputLeftSignal, InputRightSignal);
+        }
+
+        virtual void Reset(const IOperator::FResetParams& InParams)
+        {
+            // No state: the output's channels are the inputs, reset by the nodes that write them
+        }
+
+        virtual void Execute()
+        {
+            METASOUNDBRANCHES_EXECUTE_SCOPE(FStereoJoinOperator);
+
+            // Nothing to copy: the output's channels are the inputs
+        }
+
+    private:
+        METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(FStereoJoinOperator);
+
+        FAudioBufferReadRef InputLeftSignal;
+        FAudioBufferReadRef InputRightSignal;
+        FStereoAudioBufferWriteRef OutputSignal;
+    };
+
+    class FStereoJoinNode : public FNodeFacade
+    {
+    public:
+        FStereoJoinNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FStereoJoinOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FStereoJoinNode);
+}
+
+#undef LOCTEXT_NAMESPACE
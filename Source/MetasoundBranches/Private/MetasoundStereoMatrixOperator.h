@@ -0,0 +1,278 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundBranches/Public/MetasoundStereoAudioBuffer.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
+#include "MetasoundBranches/Private/MetasoundBranchesKernelDispatch.h"
+#include "MetasoundBranches/Private/DSP/StereoMatrixRamp.h"
+#include "MetasoundBranches/Private/DSP/Silence.h"
+#include "MetasoundExecutableOperator.h"     // TExecutableOperator class
+#include "MetasoundPrimitives.h"             // ReadRef and WriteRef descriptions for bool, int32, float, and string
+#include "MetasoundAudioBuffer.h"            // FAudioBuffer read and write references
+#include "MetasoundNodeRegistrationMacro.h"  // PluginNodeMissingPrompt
+
+namespace Metasound
+{
+    // Names of a stereo matrix node's audio vertices: inputs in channel order (L, R, then L, R of the second
+    // pair for a crossfade), then the outputs. With TStereoMatrixStereoVertices there is one name per pair.
+    struct FStereoMatrixAudioVertexNames
+    {
+        const TCHAR* Inputs[MetasoundBranches::FStereoCrossfade::NumInputs];
+        const TCHAR* Outputs[2];
+    };
+
+    // A stereo matrix node's audio vertices as one FAudioBuffer per channel
+    template<int32 NumInputs>
+    class TStereoMatrixChannelVertices
+    {
+    public:
+        TStereoMatrixChannelVertices(const FBuildOperatorParams& InParams, const FStereoMatrixAudioVertexNames& InNames)
+            : Names(InNames)
+            , OutputLeftSignal(FAudioBufferWriteRef::CreateNew(InParams.OperatorSettings))
+            , OutputRightSignal(FAudioBufferWriteRef::CreateNew(InParams.OperatorSettings))
+        {
+            for (int32 i = 0; i < NumInputs; ++i)
+            {
+                InputSignals.Add(InParams.InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(Names.Inputs[i], InParams.OperatorSettings));
+            }
+        }
+
+        void BindInputs(FInputVertexInterfaceData& InVertexData)
+        {
+            for (int32 i = 0; i < NumInputs; ++i)
+            {
+                InVertexData.BindReadVertex(Names.Inputs[i], InputSignals[i]);
+            }
+        }
+
+        void BindOutputs(FOutputVertexInterfaceData& InVertexData)
+        {
+            InVertexData.BindWriteVertex(Names.Outputs[0], OutputLeftSignal);
+            InVertexData.BindWriteVertex(Names.Outputs[1], OutputRightSignal);
+        }
+
+        int32 Num() const { return InputSignals[0]->Num(); }
+
+        const float* GetInput(int32 Channel) const { return InputSignals[Channel]->GetData(); }
+
+        float* GetOutputLeft() { return OutputLeftSignal->GetData(); }
+        float* GetOutputRight() { return OutputRightSignal->GetData(); }
+
+        void ZeroOutputs()
+        {
+            OutputLeftSignal->Zero();
+            OutputRightSignal->Zero();
+        }
+
+    private:
+        FStereoMatrixAudioVertexNames Names;
+
+        TArray<FAudioBufferReadRef, TFixedAllocator<NumInputs>> InputSignals;
+
+        FAudioBufferWriteRef OutputLeftSignal;
+        FAudioBufferWriteRef OutputRightSignal;
+    };
+
+    // The same vertices as one FStereoAudioBuffer per input pair and one for the output: half the vertices and
+    // data references, for the nodes' StereoAudio overloads
+    template<int32 NumInputs>
+    class TStereoMatrixStereoVertices
+    {
+    public:
+        static constexpr int32 NumPairs = NumInputs / 2;
+
+        TStereoMatrixStereoVertices(const FBuildOperatorParams& InParams, const FStereoMatrixAudioVertexNames& InNames)
+            : Names(InNames)
+            , OutputLeftSignal(FAudioBufferWriteRef::CreateNew(InParams.OperatorSettings))
+            , OutputRightSignal(FAudioBufferWriteRef::CreateNew(InParams.OperatorSettings))
+            , OutputSignal(FStereoAudioBufferWriteRef::CreateNew(FAudioBufferReadRef(OutputLeftSignal), FAudioBufferReadRef(OutputRightSignal)))
+        {
+            for (int32 i = 0; i < NumPairs; ++i)
+            {
+                InputSignals.Add(InParams.InputData.GetOrCreateDefaultDataReadReference<FStereoAudioBuffer>(Names.Inputs[i], InParams.OperatorSettings));
+            }
+        }
+
+        void BindInputs(FInputVertexInterfaceData& InVertexData)
+        {
+            for (int32 i = 0; i < NumPairs; ++i)
+            {
+                InVertexData.BindReadVertex(Names.Inputs[i], InputSignals[i]);
+            }
+        }
+
+        void BindOutputs(FOutputVertexInterfaceData& InVertexData)
+        {
+            InVertexData.BindWriteVertex(Names.Outputs[0], OutputSignal);
+        }
+
+        int32 Num() const { return InputSignals[0]->Num(); }
+
+        const float* GetInput(int32 Channel) const { return InputSignals[Channel / 2]->GetChannel(Channel % 2).GetData(); }
+
+        float* GetOutputLeft() { return OutputLeftSignal->GetData(); }
+        float* GetOutputRight() { return OutputRightSignal->GetData(); }
+
+        void ZeroOutputs()
+        {
+            OutputLeftSignal->Zero();
+            OutputRightSignal->Zero();
+        }
+
+    private:
+        FStereoMatrixAudioVertexNames Names;
+
+        TArray<FStereoAudioBufferReadRef, TFixedAllocator<NumPairs>> InputSignals;
+
+        // The output's channels, written here and read through OutputSignal
+        FAudioBufferWriteRef OutputLeftSignal;
+        FAudioBufferWriteRef OutputRightSignal;
+        FStereoAudioBufferWriteRef OutputSignal;
+    };
+
+    // The operator behind every node that maps stereo audio through a matrix: Stereo Gain, Balance, Width,
+    // Inverter, Strip and Crossfade, and the audio-rate versions of these. It owns the audio vertices, the silence gate
+    // and the kernel chosen for the CPU, and ramps a control-rate matrix across the block whenever it changes;
+    // each node supplies only a KernelType for its control inputs, and picks separate channels or StereoAudio
+    // values for its audio with AudioVerticesType:
+    //
+    //     struct FMyKernel
+    //     {
+    //         // FStereoMatrix for one input pair, FStereoCrossfade for two; one of the StereoModulation.h signal
+    //         // types for an audio-rate control
+    //         using FMatrix = MetasoundBranches::FStereoMatrix;
+    //
+    //         explicit FMyKernel(const FBuildOperatorParams& InParams);  // get the control inputs
+    //
+    //         static const FVertexInterface& DeclareVertexInterface();
+    //         static FNodeClassMetadata CreateNodeClassMetadata();  // class name, version, display name, description, category
+    //         static FStereoMatrixAudioVertexNames GetAudioVertexNames();
+    //
+    //         void BindInputs(FInputVertexInterfaceData& InVertexData);
+    //
+    //         // This block's matrix; its shape picks the processing loop
+    //         FMatrix GetMatrix() const;
+    //
+    //         METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FMyOperator);
+    //     };
+    template<typename KernelType, typename AudioVerticesType = TStereoMatrixChannelVertices<KernelType::FMatrix::NumInputs>>
+    class TStereoMatrixOperator : public TExecutableOperator<TStereoMatrixOperator<KernelType, AudioVerticesType>>
+    {
+    public:
+        using FMatrix = typename KernelType::FMatrix;
+
+        static constexpr int32 NumInputs = FMatrix::NumInputs;
+
+        explicit TStereoMatrixOperator(const FBuildOperatorParams& InParams)
+            : AudioVertices(InParams, KernelType::GetAudioVertexNames())
+            , Kernel(InParams)
+            , MatrixRamp(MetasoundBranches::GetOperatorSimdLevel())
+        {
+        }
+
+        static const FVertexInterface& DeclareVertexInterface()
+        {
+            return KernelType::DeclareVertexInterface();
+        }
+
+        static const FNodeClassMetadata& GetNodeInfo()
+        {
+            auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
+                {
+                    FNodeClassMetadata Metadata = KernelType::CreateNodeClassMetadata();
+
+                    Metadata.Author = "Charles Matthews";
+                    Metadata.PromptIfMissing = PluginNodeMissingPrompt;
+                    Metadata.DefaultInterface = DeclareVertexInterface();
+                    Metadata.Keywords = TArray<FText>();
+
+                    return Metadata;
+                };
+
+            static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+            return Metadata;
+        }
+
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
+        {
+            AudioVertices.BindInputs(InVertexData);
+            Kernel.BindInputs(InVertexData);
+        }
+
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
+        {
+            AudioVertices.BindOutputs(InVertexData);
+
+            // The gate remembers that the old outputs hold zeros; rebound buffers may not
+            SilenceGate.Reset();
+        }
+
+        static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+        {
+            return MakeUnique<TStereoMatrixOperator>(InParams);
+        }
+
+        virtual void Reset(const IOperator::FResetParams& InParams)
+        {
+            AudioVertices.ZeroOutputs();
+            SilenceGate.Reset();
+            MatrixRamp.Reset();
+        }
+
+        void Execute()
+        {
+            KernelType::ExecuteScoped([this]()
+                {
+                    const int32 NumFrames = AudioVertices.Num();
+                    float* OutLeft = AudioVertices.GetOutputLeft();
+                    float* OutRight = AudioVertices.GetOutputRight();
+                    const FMatrix Matrix = Kernel.GetMatrix();
+
+                    if constexpr (NumInputs == 2)
+                    {
+                        const float* InLeft = AudioVertices.GetInput(0);
+                        const float* InRight = AudioVertices.GetInput(1);
+
+                        if (SilenceGate.SkipBlock({ InLeft, InRight }, { OutLeft, OutRight }, NumFrames))
+                        {
+                            MatrixRamp.Skip(Matrix);
+                        }
+                        else
+                        {
+                            MatrixRamp.Process(Matrix, InLeft, InRight, OutLeft, OutRight, NumFrames);
+                        }
+                    }
+                    else
+                    {
+                        const float* InLeftA = AudioVertices.GetInput(0);
+                        const float* InRightA = AudioVertices.GetInput(1);
+                        const float* InLeftB = AudioVertices.GetInput(2);
+                        const float* InRightB = AudioVertices.GetInput(3);
+
+                        if (SilenceGate.SkipBlock({ InLeftA, InRightA, InLeftB, InRightB }, { OutLeft, OutRight }, NumFrames))
+                        {
+                            MatrixRamp.Skip(Matrix);
+                        }
+                        else
+                        {
+                            MatrixRamp.Process(Matrix, InLeftA, InRightA, InLeftB, InRightB, OutLeft, OutRight, NumFrames);
+                        }
+                    }
+                });
+        }
+
+    private:
+        // Audio inputs and outputs
+        AudioVerticesType AudioVertices;
+
+        // Control inputs and the matrix they make
+        KernelType Kernel;
+
+        // Zero output for silent input, without reprocessing or refilling it every block
+        MetasoundBranches::FSilenceGate SilenceGate;
+
+        // Kernels chosen for the CPU when the operator is created, and the previous block's matrix
+        MetasoundBranches::TStereoMatrixRamp<FMatrix> MatrixRamp;
+    };
+}
@@ -0,0 +1,139 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Public/MetasoundStereoSplitNode.h"
+#include "MetasoundBranches/Public/MetasoundStereoAudioBuffer.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundFacade.h"
+#include "MetasoundParamHelper.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundStereoSplitNode"
+
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FStereoSplitOperator);
+
+namespace Metasound
+{
+    namespace StereoSplitNodeNames
+    {
+        METASOUND_PARAM(InputSignal, "In", "Stereo audio value to split.");
+        METASOUND_PARAM(OutputLeftSignal, "Out L", "Left output channel.");
+        METASOUND_PARAM(OutputRightSignal, "Out R", "Right output channel.");
+    }
+
+    class FStereoSplitOperator : public TExecutableOperator<FStereoSplitOperator>
+    {
+    public:
+        FStereoSplitOperator(
+            const FOperatorSettings& InSettings,
+            const FStereoAudioBufferReadRef& InSignal)
+            : InputSignal(InSignal)
+            , OutputLeftSignal(InSignal->GetLeftReference())
+            , OutputRightSignal(InSignal->GetRightReference())
+        {
+        }
+
+        static const FVertexInterface& DeclareVertexInterface()
+        {
+            using namespace StereoSplitNodeNames;
+
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputSignal))
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputLeftSignal)),
+                    TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputRightSignal))
+                )
+            );
+
+            return Interface;
+        }
+
+        static const FNodeClassMetadata& GetNodeInfo()
+        {
+            auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
+            {
+                FNodeClassMetadata Metadata;
+                Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Split"), TEXT("StereoAudio") };
+                Metadata.MajorVersion = 1;
+                Metadata.MinorVersion = 0;
+                Metadata.DisplayName = METASOUND_LOCTEXT("StereoSplitDisplayName", "Stereo Split");
+                Metadata.Description = METASOUND_LOCTEXT("StereoSplitDesc", "Separates a stereo audio value into left and right audio.");
+                Metadata.Author = "Charles Matthews";
+                Metadata.PromptIfMissing = PluginNodeMissingPrompt;
+                Metadata.DefaultInterface = DeclareVertexInterface();
+                Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
+                Metadata.Keywords = TArray<FText>();
+
+                return Metadata;
+            };
+
+            static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+            return Metadata;
+        }
+
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
+        {
+            using namespace StereoSplitNodeNames;
+
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputSignal), InputSignal);
+        }
+
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
+        {
+            using namespace StereoSplitNodeNames;
+
+            // The outputs are the input's channels themselves, taken from whichever value is bound now
+            OutputLeftSignal = InputSignal->GetLeftReference();
+            OutputRightSignal = InputSignal->GetRightReference();
+
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutputLeftSignal), OutputLeftSignal);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutputRightSignal), OutputRightSignal);
+        }
+
+        static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+        {
+            using namespace StereoSplitNodeNames;
+
+            FStereoAudioBufferReadRef InputSignal = InParams.InputData.GetOrCreateDefaultDataReadReference<FStereoAudioBuffer>(
+                METASOUND_GET_PARAM_NAME(InputSignal),
+                InParams.OperatorSettings
+            );
+
+            return MakeUnique<FStereoSplitOperator>(InParams.OperatorSettings, InputSignal);
+        }
+
+        virtual void Reset(const IOperator::FResetParams& InParams)
+        {
+            // No state: the outputs are the input's channels, reset by the node that writes them
+        }
+
+        virtual void Execute()
+        {
+            METASOUNDBRANCHES_EXECUTE_SCOPE(FStereoSplitOperator);
+
+            // Nothing to copy: the outputs are the input's channels
+        }
+
+    private:
+        METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(FStereoSplitOperator);
+
+        FStereoAudioBufferReadRef InputSignal;
+        FAudioBufferReadRef OutputLeftSignal;
+        FAudioBufferReadRef OutputRightSignal;
+    };
+
+    class FStereoSplitNode : public FNodeFacade
+    {
+    public:
+        FStereoSplitNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FStereoSplitOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FStereoSplitNode);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,210 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Public/MetasoundStereoStripNode.h"
+#include "MetasoundBranches/Private/MetasoundStereoMatrixOperator.h"
+#include "MetasoundNodeRegistrationMacro.h"  // METASOUND_LOCTEXT and METASOUND_REGISTER_NODE macros
+#include "MetasoundFacade.h"                 // FNodeFacade class, eliminates the need for a fair amount of boilerplate code
+#include "MetasoundParamHelper.h"            // METASOUND_PARAM and METASOUND_GET_PARAM family of macros
+
+#define LOCTEXT_NAMESPACE "MetasoundStereoStripNode"
+
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FStereoStripOperator);
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FStereoStripStereoAudioOperator);
+
+namespace Metasound
+{
+    namespace StereoStripNodeNames
+    {
+        METASOUND_PARAM(InputLeftSignal, "In L", "Left channel audio input.");
+        METASOUND_PARAM(InputRightSignal, "In R", "Right channel audio input.");
+        METASOUND_PARAM(InputGain, "Gain (Lin)", "Gain control (0.0 to 1.0).");
+        METASOUND_PARAM(InputBalance, "Balance", "Balance control ranging from -1.0 (full left) to 1.0 (full right).");
+        METASOUND_PARAM(InputWidth, "Width", "Stereo width factor ranging from 0 to 200% (0 - 2).");
+        METASOUND_PARAM(InputInvertLeft, "Invert L", "Invert the polarity of the left channel.");
+        METASOUND_PARAM(InputInvertRight, "Invert R", "Invert the polarity of the right channel.");
+        METASOUND_PARAM(InputSwapChannels, "Swap L/R", "Swap the left and right channels.");
+
+        METASOUND_PARAM(OutputLeftSignal, "Out L", "Left output channel.");
+        METASOUND_PARAM(OutputRightSignal, "Out R", "Right output channel.");
+
+        METASOUND_PARAM(InputStereoSignal, "In", "Stereo audio input.");
+        METASOUND_PARAM(OutputStereoSignal, "Out", "Stereo output.");
+    }
+
+    // Stereo Gain, Balance, Width and Inverter in that order, composed into one matrix per block so the audio
+    // is read and written once rather than four times
+    struct FStereoStripControls
+    {
+        using FMatrix = MetasoundBranches::FStereoMatrix;
+
+        explicit FStereoStripControls(const FBuildOperatorParams& InParams)
+            : InputGain(InParams.InputData.GetOrCreateDefaultDataReadReference<float>(METASOUND_GET_PARAM_NAME(StereoStripNodeNames::InputGain), InParams.OperatorSettings))
+            , InputBalance(InParams.InputData.GetOrCreateDefaultDataReadReference<float>(METASOUND_GET_PARAM_NAME(StereoStripNodeNames::InputBalance), InParams.OperatorSettings))
+            , InputWidth(InParams.InputData.GetOrCreateDefaultDataReadReference<float>(METASOUND_GET_PARAM_NAME(StereoStripNodeNames::InputWidth), InParams.OperatorSettings))
+            , InputInvertLeft(InParams.InputData.GetOrCreateDefaultDataReadReference<bool>(METASOUND_GET_PARAM_NAME(StereoStripNodeNames::InputInvertLeft), InParams.OperatorSettings))
+            , InputInvertRight(InParams.InputData.GetOrCreateDefaultDataReadReference<bool>(METASOUND_GET_PARAM_NAME(StereoStripNodeNames::InputInvertRight), InParams.OperatorSettings))
+            , InputSwapChannels(InParams.InputData.GetOrCreateDefaultDataReadReference<bool>(METASOUND_GET_PARAM_NAME(StereoStripNodeNames::InputSwapChannels), InParams.OperatorSettings))
+        {
+        }
+
+        void BindInputs(FInputVertexInterfaceData& InVertexData)
+        {
+            using namespace StereoStripNodeNames;
+
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputGain), InputGain);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputBalance), InputBalance);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputWidth), InputWidth);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputInvertLeft), InputInvertLeft);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputInvertRight), InputInvertRight);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputSwapChannels), InputSwapChannels);
+        }
+
+        FMatrix GetMatrix() const
+        {
+            return FMatrix::Gain(*InputGain)
+                .Then(FMatrix::Balance(*InputBalance))
+                .Then(FMatrix::Width(*InputWidth))
+                .Then(FMatrix::Inverter(*InputInvertLeft, *InputInvertRight, *InputSwapChannels));
+        }
+
+        FFloatReadRef InputGain;
+        FFloatReadRef InputBalance;
+        FFloatReadRef InputWidth;
+        FBoolReadRef InputInvertLeft;
+        FBoolReadRef InputInvertRight;
+        FBoolReadRef InputSwapChannels;
+    };
+
+    struct FStereoStripKernel : FStereoStripControls
+    {
+        using FStereoStripControls::FStereoStripControls;
+
+        static const FVertexInterface& DeclareVertexInterface()
+        {
+            using namespace StereoStripNodeNames;
+
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputLeftSignal)),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputRightSignal)),
+                    TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputGain), 1.0f),
+                    TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputBalance), 0.0f),
+                    TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputWidth), 1.0f),
+                    TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputInvertLeft), false),
+                    TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputInvertRight), false),
+                    TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputSwapChannels), false)
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputLeftSignal)),
+                    TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputRightSignal))
+                )
+            );
+
+            return Interface;
+        }
+
+        static FNodeClassMetadata CreateNodeClassMetadata()
+        {
+            FNodeClassMetadata Metadata;
+
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Strip"), TEXT("Audio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("StereoStripNodeDisplayName", "Stereo Strip");
+            Metadata.Description = METASOUND_LOCTEXT("StereoStripNodeDesc", "Gain, balance, width and polarity/swap for a stereo signal in one pass, in that order.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
+
+            return Metadata;
+        }
+
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
+        {
+            using namespace StereoStripNodeNames;
+
+            return {
+                { METASOUND_GET_PARAM_NAME(InputLeftSignal), METASOUND_GET_PARAM_NAME(InputRightSignal) },
+                { METASOUND_GET_PARAM_NAME(OutputLeftSignal), METASOUND_GET_PARAM_NAME(OutputRightSignal) }
+            };
+        }
+
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FStereoStripOperator);
+    };
+
+    // The StereoAudio overload: the same node with one audio vertex per stereo pair
+    struct FStereoStripStereoAudioKernel : FStereoStripControls
+    {
+        using FStereoStripControls::FStereoStripControls;
+
+        static const FVertexInterface& DeclareVertexInterface()
+        {
+            using namespace StereoStripNodeNames;
+
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputStereoSignal)),
+                    TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputGain), 1.0f),
+                    TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputBalance), 0.0f),
+                    TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputWidth), 1.0f),
+                    TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputInvertLeft), false),
+                    TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputInvertRight), false),
+                    TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputSwapChannels), false)
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputStereoSignal))
+                )
+            );
+
+            return Interface;
+        }
+
+        static FNodeClassMetadata CreateNodeClassMetadata()
+        {
+            FNodeClassMetadata Metadata;
+
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Strip"), TEXT("StereoAudio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("StereoStripStereoAudioNodeDisplayName", "Stereo Strip (Stereo Audio)");
+            Metadata.Description = METASOUND_LOCTEXT("StereoStripStereoAudioNodeDesc", "Gain, balance, width and polarity/swap for a stereo signal in one pass, in that order.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
+
+            return Metadata;
+        }
+
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
+        {
+            using namespace StereoStripNodeNames;
+
+            return { { METASOUND_GET_PARAM_NAME(InputStereoSignal) }, { METASOUND_GET_PARAM_NAME(OutputStereoSignal) } };
+        }
+
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FStereoStripStereoAudioOperator);
+    };
+
+    using FStereoStripOperator = TStereoMatrixOperator<FStereoStripKernel>;
+    using FStereoStripStereoAudioOperator = TStereoMatrixOperator<FStereoStripStereoAudioKernel, TStereoMatrixStereoVertices<FStereoStripStereoAudioKernel::FMatrix::NumInputs>>;
+
+    class FStereoStripNode : public FNodeFacade
+    {
+    public:
+        FStereoStripNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FStereoStripOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FStereoStripNode);
+
+    class FStereoStripStereoAudioNode : public FNodeFacade
+    {
+    public:
+        FStereoStripStereoAudioNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FStereoStripStereoAudioOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FStereoStripStereoAudioNode);
+}
+
+#undef LOCTEXT_NAMESPACE
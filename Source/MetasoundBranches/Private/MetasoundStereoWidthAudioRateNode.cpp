@@ -0,0 +1,175 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "MetasoundBranches/Public/MetasoundStereoWidthAudioRateNode.h"
+#include "MetasoundBranches/Private/MetasoundStereoMatrixOperator.h"
+#include "MetasoundBranches/Private/DSP/StereoModulation.h"
+#include "MetasoundNodeRegistrationMacro.h"  // METASOUND_LOCTEXT and METASOUND_REGISTER_NODE macros
+#include "MetasoundFacade.h"                 // FNodeFacade class, eliminates the need for a fair amount of boilerplate code
+#include "MetasoundParamHelper.h"            // METASOUND_PARAM and METASOUND_GET_PARAM family of macros
+
+#define LOCTEXT_NAMESPACE "MetasoundStereoWidthAudioRateNode"
+
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FWidthAudioRateOperator);
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FWidthAudioRateStereoAudioOperator);
+
+namespace Metasound
+{
+    namespace WidthAudioRateNodeNames
+    {
+        METASOUND_PARAM(InputLeftSignal, "In L", "Left channel.");
+        METASOUND_PARAM(InputRightSignal, "In R", "Right channel.");
+        METASOUND_PARAM(InputWidth, "Width", "Stereo width signal ranging from 0 to 200% (0 - 2), read per sample.");
+
+        METASOUND_PARAM(OutputLeftSignal, "Out L", "Left channel of the adjusted stereo output signal.");
+        METASOUND_PARAM(OutputRightSignal, "Out R", "Right channel of the adjusted stereo output signal.");
+
+        METASOUND_PARAM(InputStereoSignal, "In", "Stereo audio input.");
+        METASOUND_PARAM(OutputStereoSignal, "Out", "Stereo output.");
+    }
+
+    // The control inputs and the matrix they make, shared by the node's two overloads
+    struct FWidthAudioRateControls
+    {
+        using FMatrix = MetasoundBranches::FStereoWidthSignal;
+
+        explicit FWidthAudioRateControls(const FBuildOperatorParams& InParams)
+            : InputWidth(InParams.InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(WidthAudioRateNodeNames::InputWidth), InParams.OperatorSettings))
+        {
+        }
+
+        void BindInputs(FInputVertexInterfaceData& InVertexData)
+        {
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(WidthAudioRateNodeNames::InputWidth), InputWidth);
+        }
+
+        FMatrix GetMatrix() const
+        {
+            return FMatrix{ InputWidth->GetData() };
+        }
+
+        FAudioBufferReadRef InputWidth;
+    };
+
+    struct FWidthAudioRateKernel : FWidthAudioRateControls
+    {
+        using FWidthAudioRateControls::FWidthAudioRateControls;
+
+        static const FVertexInterface& DeclareVertexInterface()
+        {
+            using namespace WidthAudioRateNodeNames;
+
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputLeftSignal)),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputRightSignal)),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputWidth))
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputLeftSignal)),
+                    TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputRightSignal))
+                )
+            );
+
+            return Interface;
+        }
+
+        static FNodeClassMetadata CreateNodeClassMetadata()
+        {
+            FNodeClassMetadata Metadata;
+
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Width (Audio Rate)"), TEXT("Audio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("WidthAudioRateNodeDisplayName", "Stereo Width (Audio Rate)");
+            Metadata.Description = METASOUND_LOCTEXT("WidthAudioRateNodeDesc", "Adjusts the stereo width of a signal from a width signal, sample by sample.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
+
+            return Metadata;
+        }
+
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
+        {
+            using namespace WidthAudioRateNodeNames;
+
+            return {
+                { METASOUND_GET_PARAM_NAME(InputLeftSignal), METASOUND_GET_PARAM_NAME(InputRightSignal) },
+                { METASOUND_GET_PARAM_NAME(OutputLeftSignal), METASOUND_GET_PARAM_NAME(OutputRightSignal) }
+            };
+        }
+
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FWidthAudioRateOperator);
+    };
+
+    // The StereoAudio overload: the same node with one audio vertex per stereo pair
+    struct FWidthAudioRateStereoAudioKernel : FWidthAudioRateControls
+    {
+        using FWidthAudioRateControls::FWidthAudioRateControls;
+
+        static const FVertexInterface& DeclareVertexInterface()
+        {
+            using namespace WidthAudioRateNodeNames;
+
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputStereoSignal)),
+                    TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputWidth))
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputStereoSignal))
+                )
+            );
+
+            return Interface;
+        }
+
+        static FNodeClassMetadata CreateNodeClassMetadata()
+        {
+            FNodeClassMetadata Metadata;
+
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Width (Audio Rate)"), TEXT("StereoAudio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("WidthAudioRateStereoAudioNodeDisplayName", "Stereo Width (Audio Rate, Stereo Audio)");
+            Metadata.Description = METASOUND_LOCTEXT("WidthAudioRateStereoAudioNodeDesc", "Adjusts the stereo width of a signal from a width signal, sample by sample.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
+
+            return Metadata;
+        }
+
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
+        {
+            using namespace WidthAudioRateNodeNames;
+
+            return { { METASOUND_GET_PARAM_NAME(InputStereoSignal) }, { METASOUND_GET_PARAM_NAME(OutputStereoSignal) } };
+        }
+
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FWidthAudioRateStereoAudioOperator);
+    };
+
+    using FWidthAudioRateOperator = TStereoMatrixOperator<FWidthAudioRateKernel>;
+    using FWidthAudioRateStereoAudioOperator = TStereoMatrixOperator<FWidthAudioRateStereoAudioKernel, TStereoMatrixStereoVertices<FWidthAudioRateStereoAudioKernel::FMatrix::NumInputs>>;
+
+    class FWidthAudioRateNode : public FNodeFacade
+    {
+    public:
+        FWidthAudioRateNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FWidthAudioRateOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FWidthAudioRateNode);
+
+    class FWidthAudioRateStereoAudioNode : public FNodeFacade
+    {
+    public:
+        FWidthAudioRateStereoAudioNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FWidthAudioRateStereoAudioOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FWidthAudioRateStereoAudioNode);
+}
+
+#undef LOCTEXT_NAMESPACE
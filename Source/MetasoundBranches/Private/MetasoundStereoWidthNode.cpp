@@ -1,14 +1,16 @@
 // Copyright 2025 Charles Matthews. All Rights Reserved.
 
 #include "MetasoundBranches/Public/MetasoundStereoWidthNode.h"
-#include "MetasoundExecutableOperator.h"     // TExecutableOperator class
-#include "MetasoundPrimitives.h"             // ReadRef and WriteRef descriptions for bool, int32, float, and string
+#include "MetasoundBranches/Private/MetasoundStereoMatrixOperator.h"
 #include "MetasoundNodeRegistrationMacro.h"  // METASOUND_LOCTEXT and METASOUND_REGISTER_NODE macros
 #include "MetasoundFacade.h"                 // FNodeFacade class, eliminates the need for a fair amount of boilerplate code
 #include "MetasoundParamHelper.h"            // METASOUND_PARAM and METASOUND_GET_PARAM family of macros
 
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodes_StereoWidthNode"
 
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FWidthOperator);
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FWidthStereoAudioOperator);
+
 namespace Metasound
 {
     namespace WidthNodeNames
@@ -19,24 +21,38 @@ namespace Metasound
 
         METASOUND_PARAM(OutputLeftSignal, "Out L", "Left channel of the adjusted stereo output signal.");
         METASOUND_PARAM(OutputRightSignal, "Out R", "Right channel of the adjusted stereo output signal.");
+
+        METASOUND_PARAM(InputStereoSignal, "In", "Stereo audio input.");
+        METASOUND_PARAM(OutputStereoSignal, "Out", "Stereo output.");
     }
 
-    class FWidthOperator : public TExecutableOperator<FWidthOperator>
+    // The control inputs and the matrix they make, shared by the node's two overloads
+    struct FWidthControls
     {
-    public:
-        FWidthOperator(
-            const FOperatorSettings& InSettings,
-            const FAudioBufferReadRef& InLeftSignal,
-            const FAudioBufferReadRef& InRightSignal,
-            const FFloatReadRef& InWidth)
-            : InputLeftSignal(InLeftSignal)
-            , InputRightSignal(InRightSignal)
-            , InputWidth(InWidth)
-            , OutputLeftSignal(FAudioBufferWriteRef::CreateNew(InSettings))
-            , OutputRightSignal(FAudioBufferWriteRef::CreateNew(InSettings))
+        using FMatrix = MetasoundBranches::FStereoMatrix;
+
+        explicit FWidthControls(const FBuildOperatorParams& InParams)
+            : InputWidth(InParams.InputData.GetOrCreateDefaultDataReadReference<float>(METASOUND_GET_PARAM_NAME(WidthNodeNames::InputWidth), InParams.OperatorSettings))
+        {
+        }
+
+        void BindInputs(FInputVertexInterfaceData& InVertexData)
         {
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(WidthNodeNames::InputWidth), InputWidth);
         }
 
+        FMatrix GetMatrix() const
+        {
+            return FMatrix::Width(*InputWidth);
+        }
+
+        FFloatReadRef InputWidth;
+    };
+
+    struct FWidthKernel : FWidthControls
+    {
+        using FWidthControls::FWidthControls;
+
         static const FVertexInterface& DeclareVertexInterface()
         {
             using namespace WidthNodeNames;
@@ -56,109 +72,82 @@ namespace Metasound
             return Interface;
         }
 
-        static const FNodeClassMetadata& GetNodeInfo()
+        static FNodeClassMetadata CreateNodeClassMetadata()
         {
-            auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
-                {
-                    FVertexInterface NodeInterface = DeclareVertexInterface();
-
-                    FNodeClassMetadata Metadata;
-
-                    Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Width"), TEXT("Audio") };
-                    Metadata.MajorVersion = 1;
-                    Metadata.MinorVersion = 0;
-                    Metadata.DisplayName = METASOUND_LOCTEXT("WidthNodeDisplayName", "Stereo Width");
-                    Metadata.Description = METASOUND_LOCTEXT("WidthNodeDesc", "Adjusts the stereo width of a signal.");
-                    Metadata.Author = "Charles Matthews";
-                    Metadata.PromptIfMissing = PluginNodeMissingPrompt;
-                    Metadata.DefaultInterface = DeclareVertexInterface();
-                    Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
-                    Metadata.Keywords = TArray<FText>(); // Keywords for searching
-
-                    return Metadata;
-                };
-
-            static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+            FNodeClassMetadata Metadata;
+
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Width"), TEXT("Audio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("WidthNodeDisplayName", "Stereo Width");
+            Metadata.Description = METASOUND_LOCTEXT("WidthNodeDesc", "Adjusts the stereo width of a signal.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
+
             return Metadata;
         }
 
-        virtual FDataReferenceCollection GetInputs() const override
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
         {
             using namespace WidthNodeNames;
 
-            FDataReferenceCollection InputDataReferences;
+            return {
+                { METASOUND_GET_PARAM_NAME(InputLeftSignal), METASOUND_GET_PARAM_NAME(InputRightSignal) },
+                { METASOUND_GET_PARAM_NAME(OutputLeftSignal), METASOUND_GET_PARAM_NAME(OutputRightSignal) }
+            };
+        }
 
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputLeftSignal), InputLeftSignal);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputRightSignal), InputRightSignal);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputWidth), InputWidth);
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FWidthOperator);
+    };
 
-            return InputDataReferences;
-        }
+    // The StereoAudio overload: the same node with one audio vertex per stereo pair
+    struct FWidthStereoAudioKernel : FWidthControls
+    {
+        using FWidthControls::FWidthControls;
 
-        virtual FDataReferenceCollection GetOutputs() const override
+        static const FVertexInterface& DeclareVertexInterface()
         {
             using namespace WidthNodeNames;
 
-            FDataReferenceCollection OutputDataReferences;
-
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputLeftSignal), OutputLeftSignal);
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputRightSignal), OutputRightSignal);
+            static const FVertexInterface Interface(
+                FInputVertexInterface(
+                    TInputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputStereoSignal)),
+                    TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputWidth), 1.0f)
+                ),
+                FOutputVertexInterface(
+                    TOutputDataVertex<FStereoAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputStereoSignal))
+                )
+            );
 
-            return OutputDataReferences;
+            return Interface;
         }
 
-        static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+        static FNodeClassMetadata CreateNodeClassMetadata()
         {
-            using namespace WidthNodeNames;
-
-            const FInputVertexInterfaceData& InputData = InParams.InputData;
-            const Metasound::FInputVertexInterface& InputInterface = DeclareVertexInterface().GetInputInterface();
+            FNodeClassMetadata Metadata;
 
-            TDataReadReference<FAudioBuffer> InputLeftSignal = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputLeftSignal), InParams.OperatorSettings);
-            TDataReadReference<FAudioBuffer> InputRightSignal = InputData.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputRightSignal), InParams.OperatorSettings);
-            TDataReadReference<float> InputWidth = InputData.GetOrCreateDefaultDataReadReference<float>(METASOUND_GET_PARAM_NAME(InputWidth), InParams.OperatorSettings);
+            Metadata.ClassName = { TEXT("UE"), TEXT("Stereo Width"), TEXT("StereoAudio") };
+            Metadata.MajorVersion = 1;
+            Metadata.MinorVersion = 0;
+            Metadata.DisplayName = METASOUND_LOCTEXT("WidthStereoAudioNodeDisplayName", "Stereo Width (Stereo Audio)");
+            Metadata.Description = METASOUND_LOCTEXT("WidthStereoAudioNodeDesc", "Adjusts the stereo width of a signal.");
+            Metadata.CategoryHierarchy = { METASOUND_LOCTEXT("Custom", "Branches") };
 
-            return MakeUnique<FWidthOperator>(InParams.OperatorSettings, InputLeftSignal, InputRightSignal, InputWidth);
+            return Metadata;
         }
 
-        void Execute()
+        static FStereoMatrixAudioVertexNames GetAudioVertexNames()
         {
-            int32 NumFrames = InputLeftSignal->Num();
-
-            const float* LeftData = InputLeftSignal->GetData();
-            const float* RightData = InputRightSignal->GetData();
-            float* OutputLeftData = OutputLeftSignal->GetData();
-            float* OutputRightData = OutputRightSignal->GetData();
-
-            float WidthFactor = FMath::Clamp(*InputWidth, 0.0f, 2.0f);
-
-            for (int32 i = 0; i < NumFrames; ++i)
-            {
-                float Left = LeftData[i];
-                float Right = RightData[i];
-
-                float Mid = 0.5f * (Left + Right);
-                float Side = 0.5f * (Left - Right);
-
-                Side *= WidthFactor;
+            using namespace WidthNodeNames;
 
-                OutputLeftData[i] = Mid + Side;
-                OutputRightData[i] = Mid - Side;
-            }
+            return { { METASOUND_GET_PARAM_NAME(InputStereoSignal) }, { METASOUND_GET_PARAM_NAME(OutputStereoSignal) } };
         }
 
-    private:
-
-        // Inputs
-        FAudioBufferReadRef InputLeftSignal;
-        FAudioBufferReadRef InputRightSignal;
-        FFloatReadRef InputWidth;
-
-        // Outputs
-        FAudioBufferWriteRef OutputLeftSignal;
-        FAudioBufferWriteRef OutputRightSignal;
+        METASOUNDBRANCHES_OPERATOR_KERNEL_STATS(FWidthStereoAudioOperator);
     };
 
+    using FWidthOperator = TStereoMatrixOperator<FWidthKernel>;
+    using FWidthStereoAudioOperator = TStereoMatrixOperator<FWidthStereoAudioKernel, TStereoMatrixStereoVertices<FWidthStereoAudioKernel::FMatrix::NumInputs>>;
+
     class FWidthNode : public FNodeFacade
     {
     public:
@@ -169,6 +158,17 @@ namespace Metasound
     };
 
     METASOUND_REGISTER_NODE(FWidthNode);
+
+    class FWidthStereoAudioNode : public FNodeFacade
+    {
+    public:
+        FWidthStereoAudioNode(const FNodeInitData& InitData)
+            : FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FWidthStereoAudioOperator>())
+        {
+        }
+    };
+
+    METASOUND_REGISTER_NODE(FWidthStereoAudioNode);
 }
 
-#undef LOCTEXT_NAMESPACE
\ No newline at end of file
+#undef LOCTEXT_NAMESPACE
@@ -1,6 +1,7 @@
 // Copyright 2025 Charles Matthews. All Rights Reserved.
 
 #include "MetasoundBranches/Public/MetasoundTuningNode.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
 #include "MetasoundExecutableOperator.h"
 #include "MetasoundPrimitives.h"
 #include "MetasoundNodeRegistrationMacro.h"
@@ -9,6 +10,8 @@
 
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodes_TuningNode"
 
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FTuningNodeOperator);
+
 namespace Metasound
 {
     namespace TuningNodeNames
@@ -118,38 +121,30 @@ namespace Metasound
             return Metadata;
         }
 
-        virtual FDataReferenceCollection GetInputs() const override
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
         {
             using namespace TuningNodeNames;
 
-            FDataReferenceCollection InputDataReferences;
-
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputMIDINoteNumber), MIDINoteNumber);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputTuningCents0), TuningCents0);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputTuningCents1), TuningCents1);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputTuningCents2), TuningCents2);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputTuningCents3), TuningCents3);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputTuningCents4), TuningCents4);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputTuningCents5), TuningCents5);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputTuningCents6), TuningCents6);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputTuningCents7), TuningCents7);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputTuningCents8), TuningCents8);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputTuningCents9), TuningCents9);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputTuningCents10), TuningCents10);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputTuningCents11), TuningCents11);
-
-            return InputDataReferences;
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputMIDINoteNumber), MIDINoteNumber);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputTuningCents0), TuningCents0);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputTuningCents1), TuningCents1);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputTuningCents2), TuningCents2);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputTuningCents3), TuningCents3);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputTuningCents4), TuningCents4);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputTuningCents5), TuningCents5);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputTuningCents6), TuningCents6);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputTuningCents7), TuningCents7);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputTuningCents8), TuningCents8);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputTuningCents9), TuningCents9);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputTuningCents10), TuningCents10);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputTuningCents11), TuningCents11);
         }
 
-        virtual FDataReferenceCollection GetOutputs() const override
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
         {
             using namespace TuningNodeNames;
 
-            FDataReferenceCollection OutputDataReferences;
-
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputFrequency), OutputFrequency);
-
-            return OutputDataReferences;
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputFrequency), OutputFrequency);
         }
 
         static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
@@ -192,7 +187,22 @@ namespace Metasound
             );
         }
 
+        virtual void Reset(const IOperator::FResetParams& InParams)
+        {
+            // No state: the output depends only on the inputs
+            UpdateFrequency();
+        }
+
         void Execute()
+        {
+            METASOUNDBRANCHES_EXECUTE_SCOPE(FTuningNodeOperator);
+
+            UpdateFrequency();
+        }
+
+    private:
+        // Shared by Execute and Reset, so resets stay out of the execute stats
+        void UpdateFrequency()
         {
             int32 midiNote = *MIDINoteNumber;
             int32 noteInOctave = midiNote % 12;
@@ -219,7 +229,8 @@ namespace Metasound
             *OutputFrequency = frequency;
         }
 
-    private:
+        METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(FTuningNodeOperator);
+
         FInt32ReadRef MIDINoteNumber;
         FFloatReadRef TuningCents0;
         FFloatReadRef TuningCents1;
@@ -4,11 +4,46 @@
 #include "MetasoundFacade.h"				 // FNodeFacade class, eliminates the need for a fair amount of boilerplate code
 #include "MetasoundParamHelper.h"            // METASOUND_PARAM and METASOUND_GET_PARAM family of macros
 #include "MetasoundWave.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
+#include "MetasoundBranches/Private/MetasoundBranchesWaveChunkPrimer.h"
 
 #define LOCTEXT_NAMESPACE "WaveArraySelectNode"
 
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FWaveArraySelectOperator);
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(TWaveArrayIndexSelectOperator);
+
 namespace Metasound
 {
+	namespace WaveAssetArraySelectPrivate
+	{
+		// True if both arrays reference the same wave proxies in the same order; compares pointers only
+		bool ContainsSameWaves(const TArray<FWaveAsset>& InA, const TArray<FWaveAsset>& InB)
+		{
+			if (InA.Num() != InB.Num())
+			{
+				return false;
+			}
+
+			for (int32 Index = 0; Index < InA.Num(); ++Index)
+			{
+				if (InA[Index].GetSoundWaveProxy() != InB[Index].GetSoundWaveProxy())
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		// Copies InSource over OutTarget in place. Reset keeps OutTarget's allocation, where assignment may
+		// reallocate it to fit, so this only allocates when InSource outgrows what the operator reserved
+		void CopyWaves(const TArray<FWaveAsset>& InSource, TArray<FWaveAsset>& OutTarget)
+		{
+			OutTarget.Reset();
+			OutTarget.Append(InSource);
+		}
+	}
+
 	namespace WaveAssetArraySelectNodeNames
 	{
 		METASOUND_PARAM(InputBoolValue, "BoolCondition", "Bool Condition")
@@ -30,6 +65,27 @@ namespace Metasound
 		// Outputs
 		FArrayDataWriteReference OutputArray;
 
+		METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(FWaveArraySelectOperator);
+
+		// Shared by Execute and Reset, so resets stay out of the execute stats
+		void UpdateSelection()
+		{
+			const TArray<FWaveAsset>& SelectedArray = *BoolCondition ? *TrueArray : *FalseArray;
+
+			// Copy only when the selection or the selected array's contents change, so steady-state
+			// blocks do no allocation and no proxy refcounting on the render thread
+			if (!WaveAssetArraySelectPrivate::ContainsSameWaves(*OutputArray, SelectedArray))
+			{
+				WaveAssetArraySelectPrivate::CopyWaves(SelectedArray, *OutputArray);
+			}
+		}
+
+		// Sizes the output for either input when the operator is built or rebound, not when Execute switches
+		void ReserveOutput()
+		{
+			OutputArray->Reserve(FMath::Max(TrueArray->Num(), FalseArray->Num()));
+		}
+
 	public:
 		FWaveArraySelectOperator(const FOperatorSettings& InSettings,
 		                         const FBoolReadRef& InBoolConditionValue,
@@ -40,11 +96,20 @@ namespace Metasound
 			, FalseArray(InFalseArrayValue)
 			, OutputArray(FArrayDataWriteReference::CreateNew())
 		{
+			ReserveOutput();
+		}
+
+		virtual void Reset(const IOperator::FResetParams& InParams)
+		{
+			// No state beyond the output: select from the current inputs
+			UpdateSelection();
 		}
 
 		void Execute()
 		{
-			*OutputArray = *BoolCondition ? *TrueArray : *FalseArray;
+			METASOUNDBRANCHES_EXECUTE_SCOPE(FWaveArraySelectOperator);
+
+			UpdateSelection();
 		}
 
 		static const FVertexInterface& DeclareVertexInterface()
@@ -119,6 +184,8 @@ namespace Metasound
 			                            TrueArray);
 			InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputFalseArray),
 			                            FalseArray);
+
+			ReserveOutput();
 		}
 
 		virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
@@ -177,5 +244,258 @@ namespace Metasound
 	};
 
 	METASOUND_REGISTER_NODE(FWaveAssetArraySelectorNode);
+
+	namespace WaveAssetArrayIndexSelectNodeNames
+	{
+		METASOUND_PARAM(InputIndex, "Index", "Index of the array to output. Out-of-range values are clamped.")
+		METASOUND_PARAM(InputNextIndex, "Next Index", "Index of the array likely to be selected next; its waves' stream chunks are loaded in the background. -1 for none.")
+		METASOUND_PARAM(OutputSelectedArray, "Output Array", "Array for the given index")
+	}
+
+	// Selects one of NumArrays wave asset arrays by index, copying only when the selection changes.
+	// A "Next Index" hint primes the first stream chunks of the candidate array on the wave chunk primer's
+	// background thread.
+	template<int32 NumArrays>
+	class TWaveArrayIndexSelectOperator : public TExecutableOperator<TWaveArrayIndexSelectOperator<NumArrays>>
+	{
+		using FArrayDataReadReference = TDataReadReference<TArray<FWaveAsset>>;
+		using FArrayDataWriteReference = TDataWriteReference<TArray<FWaveAsset>>;
+
+		// Number of leading stream chunks to load per wave
+		static constexpr uint32 NumChunksToPrime = 2;
+
+		// Inputs
+		FInt32ReadRef Index;
+		FInt32ReadRef NextIndex;
+		TArray<FArrayDataReadReference> Arrays;
+
+		// Outputs
+		FArrayDataWriteReference OutputArray;
+
+		// Hint last posted to the primer, or INDEX_NONE
+		int32 PrimedIndex = INDEX_NONE;
+
+		// Set up when the operator is built, so posting a hint doesn't allocate; null without a primer thread
+		TSharedPtr<MetasoundBranches::FWaveChunkPrimeChannel> PrimeChannel;
+
+		// Shared by Execute and Reset, so resets stay out of the execute stats
+		void UpdateSelection()
+		{
+			const TArray<FWaveAsset>& SelectedArray = *Arrays[FMath::Clamp(*Index, 0, NumArrays - 1)];
+
+			if (!WaveAssetArraySelectPrivate::ContainsSameWaves(*OutputArray, SelectedArray))
+			{
+				WaveAssetArraySelectPrivate::CopyWaves(SelectedArray, *OutputArray);
+			}
+		}
+
+		// Sizes the output for any input when the operator is built or rebound, not when Execute switches
+		void ReserveOutput()
+		{
+			int32 MaxNum = 0;
+			for (const FArrayDataReadReference& Array : Arrays)
+			{
+				MaxNum = FMath::Max(MaxNum, Array->Num());
+			}
+			OutputArray->Reserve(MaxNum);
+		}
+
+	public:
+		TWaveArrayIndexSelectOperator(const FOperatorSettings& InSettings,
+		                              const FInt32ReadRef& InIndex,
+		                              const FInt32ReadRef& InNextIndex,
+		                              const TArray<FArrayDataReadReference>& InArrays)
+			: Index(InIndex)
+			, NextIndex(InNextIndex)
+			, Arrays(InArrays)
+			, OutputArray(FArrayDataWriteReference::CreateNew())
+			, PrimeChannel(MetasoundBranches::WaveChunkPrimer::CreateChannel(NumChunksToPrime))
+		{
+			ReserveOutput();
+		}
+
+		virtual void Reset(const IOperator::FResetParams& InParams)
+		{
+			// Primed chunks are a cache and stay valid; only the selection is refreshed, and the next
+			// Execute posts any hint that is still pending
+			UpdateSelection();
+		}
+
+		void Execute()
+		{
+			METASOUNDBRANCHES_EXECUTE_SCOPE(TWaveArrayIndexSelectOperator);
+
+			UpdateSelection();
+
+			const int32 Hint = (*NextIndex >= 0 && *NextIndex < NumArrays) ? *NextIndex : INDEX_NONE;
+
+			if (Hint != PrimedIndex && PrimeChannel.IsValid())
+			{
+				const TArrayView<const FWaveAsset> Waves = (Hint != INDEX_NONE) ? TArrayView<const FWaveAsset>(*Arrays[Hint]) : TArrayView<const FWaveAsset>();
+
+				// While the primer is busy the hint stays pending and is posted again next block
+				if (PrimeChannel->Post(Waves))
+				{
+					PrimedIndex = Hint;
+				}
+			}
+		}
+
+		static FVertexName GetArrayName(int32 ArrayIndex)
+		{
+			static const TArray<FVertexName> Names = []()
+			{
+				TArray<FVertexName> Result;
+				for (int32 Index = 0; Index < NumArrays; ++Index)
+				{
+					Result.Add(FVertexName(*FString::Printf(TEXT("Array %d"), Index)));
+				}
+				return Result;
+			}();
+
+			return Names[ArrayIndex];
+		}
+
+		static const FVertexInterface& DeclareVertexInterface()
+		{
+			using namespace WaveAssetArrayIndexSelectNodeNames;
+
+			auto CreateVertexInterface = []() -> FVertexInterface
+			{
+				FInputVertexInterface InputInterface(
+					TInputDataVertex<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputIndex), 0),
+					TInputDataVertex<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputNextIndex), INDEX_NONE)
+				);
+
+				for (int32 ArrayIndex = 0; ArrayIndex < NumArrays; ++ArrayIndex)
+				{
+					const FDataVertexMetadata ArrayMetadata{ METASOUND_LOCTEXT_FORMAT("WaveAssetArrayIndexSelectArrayDesc", "Array for index {0}", ArrayIndex) };
+					InputInterface.Add(TInputDataVertex<TArray<FWaveAsset>>(GetArrayName(ArrayIndex), ArrayMetadata));
+				}
+
+				return FVertexInterface(
+					MoveTemp(InputInterface),
+					FOutputVertexInterface(
+						TOutputDataVertex<TArray<FWaveAsset>>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputSelectedArray))
+					)
+				);
+			};
+
+			static const FVertexInterface Interface = CreateVertexInterface();
+			return Interface;
+		}
+
+		static const FNodeClassMetadata& GetNodeInfo()
+		{
+			auto CreateNodeClassMetadata = []() -> FNodeClassMetadata
+			{
+				FNodeClassMetadata Metadata;
+				Metadata.ClassName = {TEXT("UE"), TEXT("Select By Index"), *FString::Printf(TEXT("WaveAssetArray%d"), NumArrays)};
+				Metadata.MajorVersion = 1;
+				Metadata.MinorVersion = 0;
+				Metadata.DisplayName = METASOUND_LOCTEXT_FORMAT("WaveAssetArrayIndexSelectDisplayName", "Select Wave Asset Array ({0})", NumArrays);
+				Metadata.Description = METASOUND_LOCTEXT("WaveAssetArrayIndexSelectDesc",
+				                                         "Select one of the input wave asset arrays by index, optionally preloading the array selected next");
+				Metadata.Author = "Sooraj Prakash";
+				Metadata.PromptIfMissing = PluginNodeMissingPrompt;
+				Metadata.DefaultInterface = DeclareVertexInterface();
+				Metadata.CategoryHierarchy = {METASOUND_LOCTEXT("Custom", "Branches")};
+				Metadata.Keywords = TArray<FText>();
+
+				return Metadata;
+			};
+
+			static const FNodeClassMetadata Metadata = CreateNodeClassMetadata();
+			return Metadata;
+		}
+
+		virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
+		{
+			using namespace WaveAssetArrayIndexSelectNodeNames;
+
+			InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputIndex), Index);
+			InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputNextIndex), NextIndex);
+
+			for (int32 ArrayIndex = 0; ArrayIndex < NumArrays; ++ArrayIndex)
+			{
+				InVertexData.BindReadVertex(GetArrayName(ArrayIndex), Arrays[ArrayIndex]);
+			}
+
+			ReserveOutput();
+		}
+
+		virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
+		{
+			using namespace WaveAssetArrayIndexSelectNodeNames;
+
+			InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputSelectedArray), OutputArray);
+		}
+
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+		{
+			using namespace WaveAssetArrayIndexSelectNodeNames;
+
+			const FInputVertexInterfaceData& InputData = InParams.InputData;
+
+			FInt32ReadRef InputIndex = InputData.GetOrCreateDefaultDataReadReference<int32>(
+				METASOUND_GET_PARAM_NAME(InputIndex),
+				InParams.OperatorSettings
+			);
+
+			FInt32ReadRef InputNextIndex = InputData.GetOrCreateDefaultDataReadReference<int32>(
+				METASOUND_GET_PARAM_NAME(InputNextIndex),
+				InParams.OperatorSettings
+			);
+
+			TArray<FArrayDataReadReference> InputArrays;
+			for (int32 ArrayIndex = 0; ArrayIndex < NumArrays; ++ArrayIndex)
+			{
+				InputArrays.Add(InputData.GetOrCreateDefaultDataReadReference<TArray<FWaveAsset>>(GetArrayName(ArrayIndex), InParams.OperatorSettings));
+			}
+
+			return MakeUnique<TWaveArrayIndexSelectOperator<NumArrays>>(InParams.OperatorSettings, InputIndex, InputNextIndex, InputArrays);
+		}
+
+	private:
+		METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(TWaveArrayIndexSelectOperator);
+	};
+
+	using FWaveArrayIndexSelect4Operator = TWaveArrayIndexSelectOperator<4>;
+	using FWaveArrayIndexSelect8Operator = TWaveArrayIndexSelectOperator<8>;
+	using FWaveArrayIndexSelect16Operator = TWaveArrayIndexSelectOperator<16>;
+
+	class FWaveAssetArrayIndexSelector4Node : public FNodeFacade
+	{
+	public:
+		FWaveAssetArrayIndexSelector4Node(const FNodeInitData& InitData)
+			: FNodeFacade(InitData.InstanceName, InitData.InstanceID,
+			              TFacadeOperatorClass<FWaveArrayIndexSelect4Operator>())
+		{
+		}
+	};
+
+	class FWaveAssetArrayIndexSelector8Node : public FNodeFacade
+	{
+	public:
+		FWaveAssetArrayIndexSelector8Node(const FNodeInitData& InitData)
+			: FNodeFacade(InitData.InstanceName, InitData.InstanceID,
+			              TFacadeOperatorClass<FWaveArrayIndexSelect8Operator>())
+		{
+		}
+	};
+
+	class FWaveAssetArrayIndexSelector16Node : public FNodeFacade
+	{
+	public:
+		FWaveAssetArrayIndexSelector16Node(const FNodeInitData& InitData)
+			: FNodeFacade(InitData.InstanceName, InitData.InstanceID,
+			              TFacadeOperatorClass<FWaveArrayIndexSelect16Operator>())
+		{
+		}
+	};
+
+	METASOUND_REGISTER_NODE(FWaveAssetArrayIndexSelector4Node);
+	METASOUND_REGISTER_NODE(FWaveAssetArrayIndexSelector8Node);
+	METASOUND_REGISTER_NODE(FWaveAssetArrayIndexSelector16Node);
 }
 #undef LOCTEXT_NAMESPACE
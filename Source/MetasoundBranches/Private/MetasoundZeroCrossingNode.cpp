@@ -1,6 +1,9 @@
 // Copyright 2025 Charles Matthews. All Rights Reserved.
 
 #include "MetasoundBranches/Public/MetasoundZeroCrossingNode.h"
+#include "MetasoundBranches/Private/MetasoundBranchesStats.h"
+#include "MetasoundBranches/Private/MetasoundBranchesKernelDispatch.h"
+#include "MetasoundBranches/Private/DSP/EdgeDetector.h"
 #include "MetasoundExecutableOperator.h"     // TExecutableOperator class
 #include "MetasoundPrimitives.h"             // ReadRef and WriteRef for data types
 #include "MetasoundNodeRegistrationMacro.h"  // METASOUND_LOCTEXT and METASOUND_REGISTER_NODE macros
@@ -10,6 +13,8 @@
 
 #define LOCTEXT_NAMESPACE "MetasoundStandardNodes_ZeroCrossing"
 
+METASOUNDBRANCHES_DECLARE_OPERATOR_STATS(FZeroCrossingOperator);
+
 namespace Metasound
 {
     namespace ZeroCrossingNames
@@ -31,11 +36,8 @@ namespace Metasound
             : InputSignal(InSignal)
             , InputDebounce(InDebounce)
             , OutputTriggerZeroCrossing(FTriggerWriteRef::CreateNew(InSettings))
-            , PreviousSignalValue(0.0f)
-            , DebounceSamples(0)
-            , DebounceCounter(0)
-            , SampleRate(InSampleRate)
         {
+            Detector.Init(InSampleRate, MetasoundBranches::GetOperatorSimdLevel());
         }
 
         static const FVertexInterface& DeclareVertexInterface()
@@ -81,25 +83,19 @@ namespace Metasound
             return Metadata;
         }
 
-        virtual FDataReferenceCollection GetInputs() const override
+        virtual void BindInputs(FInputVertexInterfaceData& InVertexData) override
         {
             using namespace ZeroCrossingNames;
 
-            FDataReferenceCollection InputDataReferences;
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputSignal), InputSignal);
-            InputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputDebounce), InputDebounce);
-
-            return InputDataReferences;
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputSignal), InputSignal);
+            InVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputDebounce), InputDebounce);
         }
 
-        virtual FDataReferenceCollection GetOutputs() const override
+        virtual void BindOutputs(FOutputVertexInterfaceData& InVertexData) override
         {
             using namespace ZeroCrossingNames;
 
-            FDataReferenceCollection OutputDataReferences;
-            OutputDataReferences.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputTriggerZeroCrossing), OutputTriggerZeroCrossing);
-
-            return OutputDataReferences;
+            InVertexData.BindWriteVertex(METASOUND_GET_PARAM_NAME(OutputTriggerZeroCrossing), OutputTriggerZeroCrossing);
         }
 
         static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
@@ -125,68 +121,25 @@ namespace Metasound
             // Reset trigger
             OutputTriggerZeroCrossing->Reset();
 
-            // Initialize PreviousSignalValue
-            if (InputSignal->Num() > 0)
-            {
-                PreviousSignalValue = InputSignal->GetData()[0];
-            }
-            else
-            {
-                PreviousSignalValue = 0.0f;
-            }
-
-            // Reset debounce counter
-            DebounceCounter = 0;
+            // Start from the first sample of the incoming signal to prevent false triggers
+            Detector.Reset(InputSignal->Num() > 0 ? InputSignal->GetData()[0] : 0.0f);
         }
 
         void Execute()
         {
-            OutputTriggerZeroCrossing->AdvanceBlock();
+            METASOUNDBRANCHES_EXECUTE_SCOPE(FZeroCrossingOperator);
 
-            const float* SignalData = InputSignal->GetData();
-            int32 NumFrames = InputSignal->Num();
-            const float DebounceTime = InputDebounce->GetSeconds();
+            OutputTriggerZeroCrossing->AdvanceBlock();
 
-            // Recalculate debounce samples if debounce time or sample rate has changed
-            if (LastDebounceTime != DebounceTime || LastSampleRate != SampleRate)
-            {
-                DebounceSamples = FMath::RoundToInt(FMath::Clamp(DebounceTime, 0.001f, 5.0f) * SampleRate);
-                LastDebounceTime = DebounceTime;
-                LastSampleRate = SampleRate;
-            }
+            Detector.SetDebounceTime(InputDebounce->GetSeconds());
 
-            for (int32 i = 0; i < NumFrames; ++i)
-            {
-                float CurrentSignal = SignalData[i];
-
-                if (DebounceCounter > 0)
-                {
-                    DebounceCounter--;
-                }
-
-                bool PreviousNonPositive = (PreviousSignalValue <= 0.0f);
-                bool CurrentPositive = (CurrentSignal > 0.0f);
-                bool PreviousNonNegative = (PreviousSignalValue >= 0.0f);
-                bool CurrentNegative = (CurrentSignal < 0.0f);
-
-                // Crossing from negative or zero to positive
-                if (PreviousNonPositive && CurrentPositive && DebounceCounter <= 0)
-                {
-                    OutputTriggerZeroCrossing->TriggerFrame(i);
-                    DebounceCounter = DebounceSamples;
-                }
-                // Crossing from positive or zero to negative
-                else if (PreviousNonNegative && CurrentNegative && DebounceCounter <= 0)
-                {
-                    OutputTriggerZeroCrossing->TriggerFrame(i);
-                    DebounceCounter = DebounceSamples;
-                }
-
-                PreviousSignalValue = CurrentSignal;
-            }
+            Detector.Process(InputSignal->GetData(), InputSignal->Num(),
+                [this](int32 Frame) { OutputTriggerZeroCrossing->TriggerFrame(Frame); });
         }
 
     private:
+        METASOUNDBRANCHES_OPERATOR_INSTANCE_COUNTER(FZeroCrossingOperator);
+
         // Inputs
         FAudioBufferReadRef InputSignal;
         FTimeReadRef InputDebounce;
@@ -194,15 +147,8 @@ namespace Metasound
         // Output
         FTriggerWriteRef OutputTriggerZeroCrossing;
 
-        // Internal variables
-        float PreviousSignalValue;
-        int32 DebounceSamples;
-        int32 DebounceCounter;
-        float SampleRate;
-
-        // Variables to track changes in debounce time and sample rate
-        float LastDebounceTime = -1.0f;
-        float LastSampleRate = -1.0f;
+        // Crossing and debounce state
+        MetasoundBranches::FZeroCrossingDetector Detector;
     };
 
     class FZeroCrossingNode : public FNodeFacade
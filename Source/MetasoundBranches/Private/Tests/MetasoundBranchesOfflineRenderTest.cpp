@@ -0,0 +1,882 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "MetasoundBranches/Public/MetasoundStereoAudioBuffer.h"
+#include "MetasoundBranches/Private/MetasoundBranchesRealtimeAudit.h"
+#include "MetasoundAudioBuffer.h"
+#include "MetasoundDataReference.h"
+#include "MetasoundEnvironment.h"
+#include "MetasoundFrontendDataTypeRegistry.h"
+#include "MetasoundFrontendRegistries.h"
+#include "MetasoundLiteral.h"
+#include "MetasoundNodeInterface.h"
+#include "MetasoundOperatorInterface.h"
+#include "MetasoundOperatorSettings.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundTrigger.h"
+#include "MetasoundVertexData.h"
+#include "MetasoundWave.h"
+#include "Algo/Find.h"
+#include "Interfaces/IPluginManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+// Offline renders of every node in the plugin, headless: each operator is built through its node's operator
+// factory, as a graph would build it, then driven block by block from generated inputs at 44.1, 48 and 96 kHz
+// and at several block sizes, with its control inputs stepped through a few settings. A summary of each output
+// is checked against golden data, every render runs under the real-time audit so a heap operation inside
+// Execute() fails the case, and the time spent in Execute() is logged per case, so a run is both a regression
+// test and a throughput report:
+//
+//     UnrealEditor-Cmd <Project> -ExecCmds="Automation RunTests MetasoundBranches.OfflineRender; Quit" -NullRHI -Unattended
+//
+// The golden data lives in the plugin's Resources/Tests folder, and an output with no entry there fails. Add
+// -MetasoundBranchesUpdateGolden to the command line to record every node instead, after adding a node or an
+// intended change to its output, and check in the file it writes.
+namespace MetasoundBranches
+{
+    namespace OfflineRenderTestPrivate
+    {
+        using namespace Metasound;
+
+        // One registered node class
+        struct FNodeCase
+        {
+            const TCHAR* Name;
+            const TCHAR* Variant;
+            int32 MajorVersion;
+            int32 MinorVersion;
+
+            // Values for control inputs, as "<input>=<value>,<value>...;<input>=...". An input steps through its
+            // values over the render, so each setting, and each change between them, is rendered. Null for none.
+            const TCHAR* Controls = nullptr;
+
+            // False where the output differs on every run (the version 1 Dust nodes seed from the clock); those
+            // are rendered and timed, but not compared
+            bool bCompareGolden = true;
+        };
+
+        const FNodeCase NodeCases[] =
+        {
+            { TEXT("BoolToAudio"), TEXT("Audio"), 1, 0, TEXT("Value=0,1,0,1;Rise Time=0.01,0.1;Fall Time=0.05,0") },
+            { TEXT("Clock Divider"), TEXT("Trigger"), 1, 0 },
+            { TEXT("Dust (Audio)"), TEXT("Audio"), 2, 0, TEXT("Density=5,200,0;Bi-Polar=1,0;Enabled=1,1,0,1") },
+            { TEXT("Dust (Audio)"), TEXT("Audio"), 1, 0, TEXT("Density=0.1,0.5;Bi-Polar=1,0"), false },
+            { TEXT("Dust (Trigger)"), TEXT("Trigger"), 2, 0, TEXT("Density=5,200,0;Enabled=1,1,0,1") },
+            { TEXT("Dust (Trigger)"), TEXT("Trigger"), 1, 0, TEXT("Density=0.1,0.5"), false },
+            { TEXT("Edge"), TEXT("Trigger"), 1, 0, TEXT("Debounce=0,0.01") },
+            { TEXT("EDO"), TEXT("Float"), 1, 0, TEXT("Note Number=60,69,72,45;Reference Frequency=440,432;Divisions=12,19,31") },
+            { TEXT("Impulse"), TEXT("Audio"), 1, 0, TEXT("Bi-Polar=1,0") },
+            { TEXT("PhaseDisperser"), TEXT("Audio"), 1, 1, TEXT("Stages=8,3,16,16,16,16,5;Profile=0,0,0,1,2,3,0") },
+            { TEXT("PhaseDisperser"), TEXT("Stereo"), 1, 0, TEXT("Stages=8,3,16,0") },
+            { TEXT("PhaseDisperser"), TEXT("Quad"), 1, 0, TEXT("Stages=8,3,16,0") },
+            { TEXT("Select"), TEXT("WaveAssetArray"), 1, 0, TEXT("BoolCondition=0,1,0,1") },
+            { TEXT("Select By Index"), TEXT("WaveAssetArray4"), 1, 0, TEXT("Index=0,3,1,5,-1;Next Index=1,-1,2,0,3") },
+            { TEXT("Select By Index"), TEXT("WaveAssetArray8"), 1, 0, TEXT("Index=0,7,2,9;Next Index=7,-1,3,0") },
+            { TEXT("Select By Index"), TEXT("WaveAssetArray16"), 1, 0, TEXT("Index=0,15,4,20;Next Index=15,-1,4,0") },
+            { TEXT("Shift Register"), TEXT("Float"), 1, 0, TEXT("In=0.25,-1,3.5,0") },
+            { TEXT("Slew (Audio)"), TEXT("Audio"), 1, 0, TEXT("Rise Time=0.01,0.1,0;Fall Time=0.05,0.2") },
+            { TEXT("Slew (Audio Rate)"), TEXT("Audio"), 1, 0 },
+            { TEXT("Slew (Float)"), TEXT("Float"), 1, 0, TEXT("In=0,1,-0.5,0.75;Rise Time=0.1,0.01;Fall Time=0.2,0.05") },
+            { TEXT("Stereo Balance"), TEXT("Audio"), 1, 0, TEXT("Balance=0,-1,0.5,1") },
+            { TEXT("Stereo Balance"), TEXT("StereoAudio"), 1, 0, TEXT("Balance=0,-1,0.5,1") },
+            { TEXT("Stereo Balance (Audio Rate)"), TEXT("Audio"), 1, 0 },
+            { TEXT("Stereo Balance (Audio Rate)"), TEXT("StereoAudio"), 1, 0 },
+            { TEXT("Stereo Crossfade"), TEXT("Audio"), 1, 0, TEXT("Crossfade=0.5,0,1,0.25") },
+            { TEXT("Stereo Crossfade"), TEXT("StereoAudio"), 1, 0, TEXT("Crossfade=0.5,0,1,0.25") },
+            { TEXT("Stereo Crossfade (Audio Rate)"), TEXT("Audio"), 1, 0 },
+            { TEXT("Stereo Crossfade (Audio Rate)"), TEXT("StereoAudio"), 1, 0 },
+            { TEXT("Stereo Gain"), TEXT("Audio"), 1, 0, TEXT("Gain (Lin)=1,0.25,0,1.5") },
+            { TEXT("Stereo Gain"), TEXT("StereoAudio"), 1, 0, TEXT("Gain (Lin)=1,0.25,0,1.5") },
+            { TEXT("Stereo Gain (Audio Rate)"), TEXT("Audio"), 1, 0 },
+            { TEXT("Stereo Gain (Audio Rate)"), TEXT("StereoAudio"), 1, 0 },
+            { TEXT("Stereo Inverter"), TEXT("Audio"), 1, 0, TEXT("Invert L=0,1,1,0;Invert R=0,0,1,1;Swap L/R=0,1") },
+            { TEXT("Stereo Inverter"), TEXT("StereoAudio"), 1, 0, TEXT("Invert L=0,1,1,0;Invert R=0,0,1,1;Swap L/R=0,1") },
+            { TEXT("Stereo Join"), TEXT("StereoAudio"), 1, 0 },
+            { TEXT("Stereo Split"), TEXT("StereoAudio"), 1, 0 },
+            { TEXT("Stereo Strip"), TEXT("Audio"), 1, 0, TEXT("Gain (Lin)=1,0.5,1;Balance=0,-0.5,0.75;Width=1,0,2,1.5;Invert L=0,1;Invert R=0,0,1;Swap L/R=0,1,0,1") },
+            { TEXT("Stereo Strip"), TEXT("StereoAudio"), 1, 0, TEXT("Gain (Lin)=1,0.5,1;Balance=0,-0.5,0.75;Width=1,0,2,1.5;Invert L=0,1;Invert R=0,0,1;Swap L/R=0,1,0,1") },
+            { TEXT("Stereo Width"), TEXT("Audio"), 1, 0, TEXT("Width=1,0,2,0.5") },
+            { TEXT("Stereo Width"), TEXT("StereoAudio"), 1, 0, TEXT("Width=1,0,2,0.5") },
+            { TEXT("Stereo Width (Audio Rate)"), TEXT("Audio"), 1, 0 },
+            { TEXT("Stereo Width (Audio Rate)"), TEXT("StereoAudio"), 1, 0 },
+            { TEXT("Tuning"), TEXT("Float"), 1, 0, TEXT("MIDI Note Number=60,61,64,69,70;+/- Cents C=0,-50;+/- Cents E=-13.7;+/- Cents A=0,25") },
+            { TEXT("Zero Crossing"), TEXT("Trigger"), 1, 0, TEXT("Debounce=0,0.01") },
+        };
+
+        const int32 SampleRates[] = { 44100, 48000, 96000 };
+
+        // 480 is not a power of two, so the kernels' remainder loops run too
+        const int32 BlockSizes[] = { 64, 256, 480, 1024 };
+
+        constexpr double RenderSeconds = 2.0;
+
+        // Audio inputs are silent over this span, so the silence gates open and close again
+        constexpr double SilenceStartSeconds = 0.5;
+        constexpr double SilenceEndSeconds = 1.0;
+
+        // Trigger input k fires every (k + 1) * TriggerPeriodSeconds
+        constexpr double TriggerPeriodSeconds = 0.05;
+
+        // Dust version 2 picks a new sequence each run for a seed of 0
+        constexpr int32 Seed = 1234;
+
+        // Output samples kept in the summary, evenly spaced over the render
+        constexpr int32 NumProbes = 16;
+
+        // Operators of each node class built and then rebound, to time both: a graph of that many nodes
+        constexpr int32 NumBindingOperators = 500;
+
+        // Golden values match within Tolerance + Tolerance * |value|, which covers the kernels' SIMD levels
+        constexpr double Tolerance = 1.0e-4;
+
+        FString GetCaseName(const FNodeCase& Case)
+        {
+            return FString::Printf(TEXT("%s (%s) v%d.%d"), Case.Name, Case.Variant, Case.MajorVersion, Case.MinorVersion);
+        }
+
+        // Deterministic noise in [-1, 1] for a frame of an input, whatever the block size
+        float Noise(int64 Frame, int32 Input)
+        {
+            uint32 Hash = static_cast<uint32>(Frame) * 2654435761u ^ static_cast<uint32>(Input + 1) * 2246822519u;
+            Hash ^= Hash >> 15;
+            Hash *= 2246822519u;
+            Hash ^= Hash >> 13;
+            return static_cast<float>(Hash) * (2.0f / 4294967295.0f) - 1.0f;
+        }
+
+        // Input k: a sine at 110 * (k + 1) Hz with some noise, silent between SilenceStartSeconds and
+        // SilenceEndSeconds
+        void FillAudioInput(FAudioBuffer& Buffer, int32 Input, int64 StartFrame, int32 SampleRate)
+        {
+            const double Frequency = 110.0 * (Input + 1);
+            float* Data = Buffer.GetData();
+
+            for (int32 i = 0; i < Buffer.Num(); ++i)
+            {
+                const int64 Frame = StartFrame + i;
+                const double Seconds = static_cast<double>(Frame) / SampleRate;
+
+                if (Seconds >= SilenceStartSeconds && Seconds < SilenceEndSeconds)
+                {
+                    Data[i] = 0.0f;
+                }
+                else
+                {
+                    const double Phase = FMath::Frac(Frequency * Seconds);
+                    Data[i] = 0.5f * FMath::Sin(static_cast<float>(UE_DOUBLE_TWO_PI * Phase)) + 0.25f * Noise(Frame, Input);
+                }
+            }
+        }
+
+        // The inputs the test drives; anything else keeps its vertex default
+        class FInputSignals
+        {
+        public:
+            FInputSignals(const FInputVertexInterface& InInterface, const FOperatorSettings& InSettings, FInputVertexInterfaceData& OutInputData)
+                : SampleRate(InSettings.GetSampleRate())
+            {
+                int32 NumWaveArrays = 0;
+
+                for (const FInputDataVertex& Vertex : InInterface)
+                {
+                    if (Vertex.DataTypeName == GetMetasoundDataTypeName<FAudioBuffer>())
+                    {
+                        FAudioBufferWriteRef Buffer = FAudioBufferWriteRef::CreateNew(InSettings);
+                        AudioInputs.Add(Buffer);
+                        OutInputData.BindReadVertex(Vertex.VertexName, FAudioBufferReadRef(Buffer));
+                    }
+                    else if (Vertex.DataTypeName == GetMetasoundDataTypeName<FStereoAudioBuffer>())
+                    {
+                        FAudioBufferWriteRef Left = FAudioBufferWriteRef::CreateNew(InSettings);
+                        FAudioBufferWriteRef Right = FAudioBufferWriteRef::CreateNew(InSettings);
+                        AudioInputs.Add(Left);
+                        AudioInputs.Add(Right);
+                        OutInputData.BindReadVertex(Vertex.VertexName, FStereoAudioBufferReadRef(FStereoAudioBufferWriteRef::CreateNew(FAudioBufferReadRef(Left), FAudioBufferReadRef(Right))));
+                    }
+                    else if (Vertex.DataTypeName == GetMetasoundDataTypeName<FTrigger>())
+                    {
+                        FTriggerWriteRef Trigger = FTriggerWriteRef::CreateNew(InSettings);
+                        TriggerInputs.Add(Trigger);
+                        OutInputData.BindReadVertex(Vertex.VertexName, FTriggerReadRef(Trigger));
+                    }
+                    else if (Vertex.DataTypeName == GetMetasoundDataTypeName<TArray<FWaveAsset>>())
+                    {
+                        // Wave array input k holds k + 1 waves, so the output's length shows which was selected.
+                        // Empty assets are enough for that, and load nothing.
+                        TArray<FWaveAsset> Waves;
+                        Waves.SetNum(++NumWaveArrays);
+                        OutInputData.BindReadVertex(Vertex.VertexName, TDataReadReference<TArray<FWaveAsset>>(TDataWriteReference<TArray<FWaveAsset>>::CreateNew(MoveTemp(Waves))));
+                    }
+                    else if (Vertex.DataTypeName == GetMetasoundDataTypeName<int32>() && Vertex.VertexName == TEXT("Seed"))
+                    {
+                        OutInputData.BindReadVertex(Vertex.VertexName, FInt32ReadRef(FInt32WriteRef::CreateNew(Seed)));
+                    }
+                }
+            }
+
+            // Writes the block starting at StartFrame
+            void Fill(int64 StartFrame, int32 NumFrames)
+            {
+                for (int32 i = 0; i < AudioInputs.Num(); ++i)
+                {
+                    FillAudioInput(*AudioInputs[i], i, StartFrame, SampleRate);
+                }
+
+                for (int32 i = 0; i < TriggerInputs.Num(); ++i)
+                {
+                    FTrigger& Trigger = *TriggerInputs[i];
+                    const int64 Period = FMath::Max<int64>(1, FMath::RoundToInt64(TriggerPeriodSeconds * (i + 1) * SampleRate));
+
+                    Trigger.AdvanceBlock();
+
+                    for (int64 Frame = FMath::DivideAndRoundUp(StartFrame, Period) * Period; Frame < StartFrame + NumFrames; Frame += Period)
+                    {
+                        Trigger.TriggerFrame(static_cast<int32>(Frame - StartFrame));
+                    }
+                }
+            }
+
+        private:
+            int32 SampleRate;
+
+            TArray<FAudioBufferWriteRef> AudioInputs;
+            TArray<FTriggerWriteRef> TriggerInputs;
+        };
+
+        // The values of FNodeCase::Controls, as data references made by each input's data type. Value k of N applies
+        // from k / N of the way through the render, at the first block boundary there.
+        class FControlSchedule
+        {
+        public:
+            // False, with the reason in OutError, for an input the node doesn't have or a value its type can't take
+            bool Init(const TCHAR* InControls, const FInputVertexInterface& InInterface, const FOperatorSettings& InSettings, FString& OutError)
+            {
+                if (InControls == nullptr)
+                {
+                    return true;
+                }
+
+                const Frontend::IDataTypeRegistry& DataTypeRegistry = Frontend::IDataTypeRegistry::Get();
+
+                TArray<FString> ControlStrings;
+                FString(InControls).ParseIntoArray(ControlStrings, TEXT(";"));
+
+                for (const FString& ControlString : ControlStrings)
+                {
+                    FString Name;
+                    FString ValuesText;
+
+                    if (!ControlString.Split(TEXT("="), &Name, &ValuesText))
+                    {
+                        OutError = FString::Printf(TEXT("control \"%s\" has no values"), *ControlString);
+                        return false;
+                    }
+
+                    const FInputDataVertex* Vertex = Algo::FindByPredicate(InInterface, [&Name](const FInputDataVertex& Candidate)
+                        {
+                            return Candidate.VertexName == FName(*Name);
+                        });
+
+                    if (Vertex == nullptr)
+                    {
+                        OutError = FString::Printf(TEXT("the node has no input \"%s\""), *Name);
+                        return false;
+                    }
+
+                    FControl& Control = Controls.Emplace_GetRef(Vertex->VertexName);
+
+                    TArray<FString> ValueStrings;
+                    ValuesText.ParseIntoArray(ValueStrings, TEXT(","));
+
+                    for (const FString& ValueString : ValueStrings)
+                    {
+                        const TOptional<FAnyDataReference> Reference = DataTypeRegistry.CreateDataReference(Vertex->DataTypeName,
+                            EDataReferenceAccessType::Write, MakeLiteral(Vertex->DataTypeName, ValueString), InSettings);
+
+                        if (!Reference.IsSet())
+                        {
+                            OutError = FString::Printf(TEXT("input \"%s\" can't take the value %s"), *Name, *ValueString);
+                            return false;
+                        }
+
+                        Control.Values.Add(*Reference);
+                    }
+                }
+
+                return true;
+            }
+
+            // Binds the values for the block starting at StartFrame. True if any changed, and the operator's inputs
+            // need binding again.
+            bool Bind(int64 StartFrame, int64 TotalFrames, FInputVertexInterfaceData& OutInputData)
+            {
+                bool bChanged = false;
+
+                for (FControl& Control : Controls)
+                {
+                    const int32 ValueIndex = static_cast<int32>(FMath::Min<int64>(StartFrame * Control.Values.Num() / TotalFrames, Control.Values.Num() - 1));
+
+                    if (ValueIndex != Control.ValueIndex)
+                    {
+                        Control.ValueIndex = ValueIndex;
+                        OutInputData.BindVertex(Control.Name, Control.Values[ValueIndex]);
+                        bChanged = true;
+                    }
+                }
+
+                return bChanged;
+            }
+
+        private:
+            // Bools take a bool literal, floats and times a float literal, and ints and enums an int32 literal
+            static FLiteral MakeLiteral(const FName& DataTypeName, const FString& Value)
+            {
+                if (DataTypeName == GetMetasoundDataTypeName<bool>())
+                {
+                    return FLiteral(FCString::Atoi(*Value) != 0);
+                }
+
+                if (DataTypeName == GetMetasoundDataTypeName<float>() || DataTypeName == GetMetasoundDataTypeName<FTime>())
+                {
+                    return FLiteral(FCString::Atof(*Value));
+                }
+
+                return FLiteral(FCString::Atoi(*Value));
+            }
+
+            struct FControl
+            {
+                explicit FControl(const FVertexName& InName)
+                    : Name(InName)
+                {
+                }
+
+                FVertexName Name;
+                TArray<FAnyDataReference> Values;
+                int32 ValueIndex = INDEX_NONE;
+            };
+
+            TArray<FControl> Controls;
+        };
+
+        // A few numbers per output that change if its signal does
+        class FOutputSummary
+        {
+        public:
+            FOutputSummary(const FString& InName, const FAnyDataReference& InReference, int64 InTotalFrames)
+                : Name(InName)
+                , Reference(InReference)
+                , TotalFrames(InTotalFrames)
+            {
+                const FName DataTypeName = Reference.GetDataTypeName();
+
+                if (DataTypeName == GetMetasoundDataTypeName<FAudioBuffer>())
+                {
+                    Channels.AddDefaulted(1);
+                }
+                else if (DataTypeName == GetMetasoundDataTypeName<FStereoAudioBuffer>())
+                {
+                    Channels.AddDefaulted(2);
+                }
+            }
+
+            const FString& GetName() const { return Name; }
+
+            void Accumulate(int64 StartFrame, int32 NumFrames)
+            {
+                const FName DataTypeName = Reference.GetDataTypeName();
+
+                if (DataTypeName == GetMetasoundDataTypeName<FAudioBuffer>())
+                {
+                    AccumulateChannel(Channels[0], Reference.GetDataReadReference<FAudioBuffer>()->GetData(), StartFrame, NumFrames);
+                }
+                else if (DataTypeName == GetMetasoundDataTypeName<FStereoAudioBuffer>())
+                {
+                    const FStereoAudioBuffer& Stereo = *Reference.GetDataReadReference<FStereoAudioBuffer>();
+                    AccumulateChannel(Channels[0], Stereo.GetLeft().GetData(), StartFrame, NumFrames);
+                    AccumulateChannel(Channels[1], Stereo.GetRight().GetData(), StartFrame, NumFrames);
+                }
+                else if (DataTypeName == GetMetasoundDataTypeName<FTrigger>())
+                {
+                    const FTrigger& Trigger = *Reference.GetDataReadReference<FTrigger>();
+                    Trigger.ExecuteBlock([](int32, int32) {}, [this, StartFrame](int32 StartFrameInBlock, int32)
+                        {
+                            ++NumTriggers;
+                            TriggerFrameSum += static_cast<double>(StartFrame + StartFrameInBlock);
+                        });
+                }
+                else if (DataTypeName == GetMetasoundDataTypeName<float>())
+                {
+                    AccumulateValue(*Reference.GetDataReadReference<float>());
+                }
+                else if (DataTypeName == GetMetasoundDataTypeName<int32>())
+                {
+                    AccumulateValue(*Reference.GetDataReadReference<int32>());
+                }
+                else if (DataTypeName == GetMetasoundDataTypeName<bool>())
+                {
+                    AccumulateValue(*Reference.GetDataReadReference<bool>() ? 1.0 : 0.0);
+                }
+                else if (DataTypeName == GetMetasoundDataTypeName<TArray<FWaveAsset>>())
+                {
+                    AccumulateValue(Reference.GetDataReadReference<TArray<FWaveAsset>>()->Num());
+                }
+            }
+
+            // For audio, per channel: RMS, peak, mean and the probe samples. For triggers: the count and mean
+            // frame. For values, and wave asset arrays by length: the last and the mean over blocks. Empty for
+            // other types.
+            TArray<double> GetValues() const
+            {
+                TArray<double> Values;
+
+                for (const FChannel& Channel : Channels)
+                {
+                    Values.Add(FMath::Sqrt(Channel.SumOfSquares / TotalFrames));
+                    Values.Add(Channel.Peak);
+                    Values.Add(Channel.Sum / TotalFrames);
+                    Values.Append(Channel.Probes, NumProbes);
+                }
+
+                const FName DataTypeName = Reference.GetDataTypeName();
+
+                if (DataTypeName == GetMetasoundDataTypeName<FTrigger>())
+                {
+                    Values.Add(static_cast<double>(NumTriggers));
+                    Values.Add(NumTriggers > 0 ? TriggerFrameSum / NumTriggers : 0.0);
+                }
+                else if (NumBlocks > 0)
+                {
+                    Values.Add(LastValue);
+                    Values.Add(ValueSum / NumBlocks);
+                }
+
+                return Values;
+            }
+
+        private:
+            struct FChannel
+            {
+                double SumOfSquares = 0.0;
+                double Sum = 0.0;
+                double Peak = 0.0;
+                double Probes[NumProbes] = {};
+            };
+
+            void AccumulateChannel(FChannel& Channel, const float* Data, int64 StartFrame, int32 NumFrames)
+            {
+                for (int32 i = 0; i < NumFrames && StartFrame + i < TotalFrames; ++i)
+                {
+                    const double Sample = Data[i];
+                    Channel.SumOfSquares += Sample * Sample;
+                    Channel.Sum += Sample;
+                    Channel.Peak = FMath::Max(Channel.Peak, FMath::Abs(Sample));
+                }
+
+                for (int32 Probe = 0; Probe < NumProbes; ++Probe)
+                {
+                    const int64 ProbeFrame = (2 * Probe + 1) * TotalFrames / (2 * NumProbes);
+
+                    if (ProbeFrame >= StartFrame && ProbeFrame < StartFrame + NumFrames)
+                    {
+                        Channel.Probes[Probe] = Data[ProbeFrame - StartFrame];
+                    }
+                }
+            }
+
+            void AccumulateValue(double Value)
+            {
+                LastValue = Value;
+                ValueSum += Value;
+                ++NumBlocks;
+            }
+
+            FString Name;
+            FAnyDataReference Reference;
+            int64 TotalFrames;
+
+            TArray<FChannel, TInlineAllocator<2>> Channels;
+
+            int64 NumTriggers = 0;
+            double TriggerFrameSum = 0.0;
+
+            double LastValue = 0.0;
+            double ValueSum = 0.0;
+            int64 NumBlocks = 0;
+        };
+
+        // Golden summaries by "<case>|<sample rate>|<block size>|<output>", one tab-separated line each
+        FString GetGoldenPath()
+        {
+            const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("MetasoundBranches"));
+            return Plugin.IsValid() ? FPaths::Combine(Plugin->GetBaseDir(), TEXT("Resources"), TEXT("Tests"), TEXT("OfflineRenderGolden.txt")) : FString();
+        }
+
+        TMap<FString, TArray<double>> LoadGolden(const FString& Path)
+        {
+            TMap<FString, TArray<double>> Golden;
+            TArray<FString> Lines;
+            FFileHelper::LoadFileToStringArray(Lines, *Path);
+
+            for (const FString& Line : Lines)
+            {
+                FString Key;
+                FString ValueText;
+
+                if (Line.Split(TEXT("\t"), &Key, &ValueText))
+                {
+                    TArray<FString> ValueStrings;
+                    ValueText.ParseIntoArray(ValueStrings, TEXT(" "));
+
+                    TArray<double>& Values = Golden.Add(Key);
+
+                    for (const FString& Value : ValueStrings)
+                    {
+                        Values.Add(FCString::Atod(*Value));
+                    }
+                }
+            }
+
+            return Golden;
+        }
+
+        bool SaveGolden(const FString& Path, TMap<FString, TArray<double>>& Golden)
+        {
+            Golden.KeySort(TLess<FString>());
+
+            TArray<FString> Lines;
+
+            for (const TPair<FString, TArray<double>>& Entry : Golden)
+            {
+                FString Line = Entry.Key + TEXT("\t");
+
+                for (int32 i = 0; i < Entry.Value.Num(); ++i)
+                {
+                    Line += FString::Printf(i == 0 ? TEXT("%.9g") : TEXT(" %.9g"), Entry.Value[i]);
+                }
+
+                Lines.Add(MoveTemp(Line));
+            }
+
+            return FFileHelper::SaveStringArrayToFile(Lines, *Path);
+        }
+
+        bool ValuesMatch(const TArray<double>& Actual, const TArray<double>& Expected)
+        {
+            if (Actual.Num() != Expected.Num())
+            {
+                return false;
+            }
+
+            for (int32 i = 0; i < Actual.Num(); ++i)
+            {
+                if (FMath::Abs(Actual[i] - Expected[i]) > Tolerance + Tolerance * FMath::Abs(Expected[i]))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // Result of one render
+        struct FRender
+        {
+            TArray<TPair<FString, TArray<double>>> Outputs;
+            int32 NumFramesPerBlock = 0;
+            int64 TotalFrames = 0;
+            double ExecuteSeconds = 0.0;
+
+            // Heap operations the real-time audit caught inside Execute()
+            uint64 NumAuditViolations = 0;
+
+            // Time to build NumBindingOperators operators, and to rebind them all in place; zero unless timed
+            double BuildSeconds = 0.0;
+            double RebindSeconds = 0.0;
+        };
+
+        // Times a graph edit both ways: rebuilding every operator, which operators without BindInputs and
+        // BindOutputs needed, against rebinding each one's vertices in place
+        void TimeBinding(const INode& Node, const FBuildOperatorParams& BuildParams, FInputVertexInterfaceData& InputData, FRender& OutRender)
+        {
+            TArray<TUniquePtr<IOperator>> Operators;
+            Operators.Reserve(NumBindingOperators);
+            FBuildResults BuildResults;
+
+            const uint64 StartBuildCycles = FPlatformTime::Cycles64();
+
+            for (int32 i = 0; i < NumBindingOperators; ++i)
+            {
+                Operators.Add(Node.GetDefaultOperatorFactory()->CreateOperator(BuildParams, BuildResults));
+            }
+
+            OutRender.BuildSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartBuildCycles);
+
+            FOutputVertexInterfaceData OutputData(Node.GetVertexInterface().GetOutputInterface());
+
+            const uint64 StartRebindCycles = FPlatformTime::Cycles64();
+
+            for (const TUniquePtr<IOperator>& Operator : Operators)
+            {
+                if (Operator.IsValid())
+                {
+                    Operator->BindInputs(InputData);
+                    Operator->BindOutputs(OutputData);
+                }
+            }
+
+            OutRender.RebindSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartRebindCycles);
+        }
+
+        // Renders RenderSeconds of a node class at one sample rate and block size, and times building and
+        // rebinding its operators if bTimeBinding. False, with the reason in OutError, if the node or its
+        // operator can't be created.
+        bool RenderCase(const FNodeCase& Case, int32 SampleRate, int32 BlockSize, bool bTimeBinding, FRender& OutRender, FString& OutError)
+        {
+            const FNodeClassName ClassName(TEXT("UE"), Case.Name, Case.Variant);
+            const Frontend::FNodeRegistryKey Key(EMetasoundFrontendClassType::External, ClassName, Case.MajorVersion, Case.MinorVersion);
+
+            FNodeInitData InitData;
+            InitData.InstanceName = TEXT("OfflineRenderTest");
+            InitData.InstanceID = FGuid::NewGuid();
+
+            const TUniquePtr<INode> Node = FMetasoundFrontendRegistryContainer::Get()->CreateNode(Key, InitData);
+
+            if (!Node.IsValid())
+            {
+                OutError = TEXT("the node class is not registered");
+                return false;
+            }
+
+            const FVertexInterface& Interface = Node->GetVertexInterface();
+            const FOperatorSettings Settings(SampleRate, static_cast<float>(SampleRate) / BlockSize);
+            const FMetasoundEnvironment Environment;
+
+            OutRender.NumFramesPerBlock = Settings.GetNumFramesPerBlock();
+            OutRender.TotalFrames = FMath::RoundToInt64(RenderSeconds * SampleRate);
+
+            FInputVertexInterfaceData InputData(Interface.GetInputInterface());
+            FInputSignals Inputs(Interface.GetInputInterface(), Settings, InputData);
+            FControlSchedule Controls;
+
+            if (!Controls.Init(Case.Controls, Interface.GetInputInterface(), Settings, OutError))
+            {
+                return false;
+            }
+
+            // The operator is built with each control's first value
+            Controls.Bind(0, OutRender.TotalFrames, InputData);
+
+            FBuildResults BuildResults;
+            const FBuildOperatorParams BuildParams{ *Node, Settings, InputData, Environment };
+            const TUniquePtr<IOperator> Operator = Node->GetDefaultOperatorFactory()->CreateOperator(BuildParams, BuildResults);
+
+            if (!Operator.IsValid() || BuildResults.Errors.Num() > 0)
+            {
+                OutError = FString::Printf(TEXT("CreateOperator failed with %d errors"), BuildResults.Errors.Num());
+                return false;
+            }
+
+            if (bTimeBinding)
+            {
+                TimeBinding(*Node, BuildParams, InputData, OutRender);
+            }
+
+            FOutputVertexInterfaceData OutputData(Interface.GetOutputInterface());
+            Operator->BindOutputs(OutputData);
+
+            TArray<FOutputSummary> Summaries;
+
+            for (const FOutputDataVertex& Vertex : Interface.GetOutputInterface())
+            {
+                if (const FAnyDataReference* Reference = OutputData.FindDataReference(Vertex.VertexName))
+                {
+                    Summaries.Emplace(Vertex.VertexName.ToString(), *Reference, OutRender.TotalFrames);
+                }
+            }
+
+            const IOperator::FExecuteFunction ExecuteFunction = Operator->GetExecuteFunction();
+            const IOperator::FPostExecuteFunction PostExecuteFunction = Operator->GetPostExecuteFunction();
+            uint64 ExecuteCycles = 0;
+
+#if METASOUNDBRANCHES_REALTIME_AUDIT
+            // The operator is built and bound by now, so from here on it should neither allocate nor free
+            RealtimeAudit::Enable();
+            const uint64 StartAuditViolations = RealtimeAudit::GetNumViolations();
+#endif
+
+            for (int64 StartFrame = 0; StartFrame < OutRender.TotalFrames; StartFrame += OutRender.NumFramesPerBlock)
+            {
+                if (Controls.Bind(StartFrame, OutRender.TotalFrames, InputData))
+                {
+                    Operator->BindInputs(InputData);
+                }
+
+                Inputs.Fill(StartFrame, OutRender.NumFramesPerBlock);
+
+                if (ExecuteFunction)
+                {
+                    const uint64 StartCycles = FPlatformTime::Cycles64();
+                    ExecuteFunction(Operator.Get());
+                    ExecuteCycles += FPlatformTime::Cycles64() - StartCycles;
+                }
+
+                for (FOutputSummary& Summary : Summaries)
+                {
+                    Summary.Accumulate(StartFrame, OutRender.NumFramesPerBlock);
+                }
+
+                if (PostExecuteFunction)
+                {
+                    PostExecuteFunction(Operator.Get());
+                }
+            }
+
+            OutRender.ExecuteSeconds = FPlatformTime::ToSeconds64(ExecuteCycles);
+
+#if METASOUNDBRANCHES_REALTIME_AUDIT
+            OutRender.NumAuditViolations = RealtimeAudit::GetNumViolations() - StartAuditViolations;
+#endif
+
+            for (const FOutputSummary& Summary : Summaries)
+            {
+                OutRender.Outputs.Emplace(Summary.GetName(), Summary.GetValues());
+            }
+
+            return true;
+        }
+    }
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FMetasoundBranchesOfflineRenderTest, "MetasoundBranches.OfflineRender",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+void FMetasoundBranchesOfflineRenderTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+    using namespace MetasoundBranches::OfflineRenderTestPrivate;
+
+    for (int32 i = 0; i < UE_ARRAY_COUNT(NodeCases); ++i)
+    {
+        OutBeautifiedNames.Add(GetCaseName(NodeCases[i]));
+        OutTestCommands.Add(FString::FromInt(i));
+    }
+}
+
+bool FMetasoundBranchesOfflineRenderTest::RunTest(const FString& Parameters)
+{
+    using namespace MetasoundBranches::OfflineRenderTestPrivate;
+
+    const int32 CaseIndex = FCString::Atoi(*Parameters);
+
+    if (!TestTrue(TEXT("Node case index"), CaseIndex >= 0 && CaseIndex < UE_ARRAY_COUNT(NodeCases)))
+    {
+        return false;
+    }
+
+    const FNodeCase& Case = NodeCases[CaseIndex];
+    const FString CaseName = GetCaseName(Case);
+
+    const FString GoldenPath = GetGoldenPath();
+
+    if (!TestFalse(TEXT("Plugin found for the golden data path"), GoldenPath.IsEmpty()))
+    {
+        return false;
+    }
+
+    TMap<FString, TArray<double>> Golden = LoadGolden(GoldenPath);
+
+    // Record rather than compare only on request: missing golden data fails the case
+    const bool bRecord = FParse::Param(FCommandLine::Get(), TEXT("MetasoundBranchesUpdateGolden"));
+
+    for (const int32 SampleRate : SampleRates)
+    {
+        for (const int32 BlockSize : BlockSizes)
+        {
+            FRender Render;
+            FString Error;
+
+            // Building and binding don't depend on the block size much, so time them once per node class
+            const bool bTimeBinding = SampleRate == SampleRates[0] && BlockSize == BlockSizes[0];
+
+            if (!RenderCase(Case, SampleRate, BlockSize, bTimeBinding, Render, Error))
+            {
+                AddError(FString::Printf(TEXT("%s at %d Hz: %s."), *CaseName, SampleRate, *Error));
+                return false;
+            }
+
+            // The block size the settings gave, which names the case
+            const FString RenderName = FString::Printf(TEXT("%s|%d|%d"), *CaseName, SampleRate, Render.NumFramesPerBlock);
+
+            const double NanosecondsPerFrame = Render.ExecuteSeconds * 1.0e9 / Render.TotalFrames;
+            const double RealtimeFactor = Render.ExecuteSeconds > 0.0 ? RenderSeconds / Render.ExecuteSeconds : 0.0;
+            AddInfo(FString::Printf(TEXT("%s at %d Hz, %d-frame blocks: %.2f ns/frame in Execute(), %.0fx real time."),
+                *CaseName, SampleRate, Render.NumFramesPerBlock, NanosecondsPerFrame, RealtimeFactor));
+
+            if (bTimeBinding)
+            {
+                AddInfo(FString::Printf(TEXT("%s: %d operators built in %.2f us each, rebound in place in %.3f us each."),
+                    *CaseName, NumBindingOperators, Render.BuildSeconds * 1.0e6 / NumBindingOperators,
+                    Render.RebindSeconds * 1.0e6 / NumBindingOperators));
+            }
+
+            if (Render.NumAuditViolations > 0)
+            {
+                AddError(FString::Printf(TEXT("%s at %d Hz, %d-frame blocks: %llu heap operation(s) inside Execute(); the log has the first callstack."),
+                    *CaseName, SampleRate, Render.NumFramesPerBlock, Render.NumAuditViolations));
+            }
+
+            if (!Case.bCompareGolden)
+            {
+                continue;
+            }
+
+            for (const TPair<FString, TArray<double>>& Output : Render.Outputs)
+            {
+                if (Output.Value.Num() == 0)
+                {
+                    continue;
+                }
+
+                const FString Key = RenderName + TEXT("|") + Output.Key;
+
+                if (bRecord)
+                {
+                    Golden.Add(Key, Output.Value);
+                }
+                else if (const TArray<double>* Expected = Golden.Find(Key))
+                {
+                    if (!ValuesMatch(Output.Value, *Expected))
+                    {
+                        AddError(FString::Printf(TEXT("%s: output differs from the golden data."), *Key));
+                    }
+                }
+                else
+                {
+                    AddError(FString::Printf(TEXT("%s: no golden data; run with -MetasoundBranchesUpdateGolden to record it."), *Key));
+                }
+            }
+        }
+    }
+
+    if (bRecord && Case.bCompareGolden)
+    {
+        if (!SaveGolden(GoldenPath, Golden))
+        {
+            AddError(FString::Printf(TEXT("Could not write golden data to %s."), *GoldenPath));
+            return false;
+        }
+
+        AddWarning(FString::Printf(TEXT("%s: recorded golden data to %s; check it in."), *CaseName, *GoldenPath));
+    }
+
+    return !HasAnyErrors();
+}
+
+#endif
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleInterface.h"
 
+DECLARE_LOG_CATEGORY_EXTERN(LogMetasoundBranches, Log, All);
+
 class FMetasoundBranchesModule : public IModuleInterface
 {
 public:
@@ -0,0 +1,21 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "Metasound.h"
+#include "MetasoundNode.h"
+
+namespace MetasoundBranches
+{
+    class FMetasoundPhaseDisperserStereoNode : public Metasound::FNode
+    {
+    public:
+        FMetasoundPhaseDisperserStereoNode();
+    };
+
+    class FMetasoundPhaseDisperserQuadNode : public Metasound::FNode
+    {
+    public:
+        FMetasoundPhaseDisperserQuadNode();
+    };
+}
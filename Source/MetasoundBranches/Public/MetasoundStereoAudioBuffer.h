@@ -0,0 +1,54 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "MetasoundAudioBuffer.h"
+#include "MetasoundDataReferenceMacro.h"
+#include "MetasoundOperatorSettings.h"
+
+namespace Metasound
+{
+    // A left and a right audio buffer carried as one MetaSound value, registered as "StereoAudio". A stereo
+    // connection is then one vertex and one data reference rather than two. Make one with Stereo Join and take
+    // it apart with Stereo Split.
+    //
+    // The channels are held as data references, so a value can be built over buffers that already exist:
+    // Stereo Join wraps its two inputs and Stereo Split hands the two channels on as its outputs, and neither
+    // copies any audio. Copies of a value share its channels. Nodes that produce one keep write references to
+    // the buffers they pass in, and write through those.
+    class METASOUNDBRANCHES_API FStereoAudioBuffer
+    {
+    public:
+        // Two new silent channels
+        explicit FStereoAudioBuffer(const FOperatorSettings& InSettings)
+            : Left(FAudioBufferWriteRef::CreateNew(InSettings))
+            , Right(FAudioBufferWriteRef::CreateNew(InSettings))
+        {
+        }
+
+        // The given channels, without copying them
+        FStereoAudioBuffer(const FAudioBufferReadRef& InLeft, const FAudioBufferReadRef& InRight)
+            : Left(InLeft)
+            , Right(InRight)
+        {
+        }
+
+        const FAudioBuffer& GetLeft() const { return *Left; }
+        const FAudioBuffer& GetRight() const { return *Right; }
+
+        // 0 for left, 1 for right
+        const FAudioBuffer& GetChannel(int32 Channel) const { return Channel == 0 ? *Left : *Right; }
+
+        const FAudioBufferReadRef& GetLeftReference() const { return Left; }
+        const FAudioBufferReadRef& GetRightReference() const { return Right; }
+
+        // Frames per channel
+        int32 Num() const { return Left->Num(); }
+
+    private:
+        FAudioBufferReadRef Left;
+        FAudioBufferReadRef Right;
+    };
+
+    DECLARE_METASOUND_DATA_REFERENCE_TYPES(FStereoAudioBuffer, METASOUNDBRANCHES_API, FStereoAudioBufferTypeInfo, FStereoAudioBufferReadRef, FStereoAudioBufferWriteRef);
+}
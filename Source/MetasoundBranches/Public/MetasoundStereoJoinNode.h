@@ -0,0 +1,15 @@
+// Copyright 2025 Charles Matthews. All Rights Reserved.
+
+#pragma once
+
+#include "Metasound.h"
+#include "MetasoundNode.h"
+
+namespace MetasoundBranches
+{
+    class FMetasoundStereoJoinNode : public Metasound::FNode
+    {
+    public:
+        FMetasoundStereoJoinNode();
+    };
+}
\ No newline at end of file